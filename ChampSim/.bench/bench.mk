@@ -0,0 +1,1188 @@
+###
+# THIS FILE IS AUTOMATICALLY GENERATED
+# Do not edit this file. It will be overwritten when the configure script is run.
+###
+
+######
+# Build ID: 1c605d13
+# Executable: /root/repo/ChampSim/.bench/bin/bench_baseline
+######
+
+###
+# Build ID: 1c605d13
+# Source: /root/repo/ChampSim/src
+# Destination: /root/repo/ChampSim/.bench/.csconfig/1c605d13/obj
+###
+
+1c605d13_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/1c605d13/obj
+1c605d13_objs_0 = $(patsubst /root/repo/ChampSim/src/%.cc, /root/repo/ChampSim/.bench/.csconfig/1c605d13/obj/%.o, $(wildcard /root/repo/ChampSim/src/*.cc))
+$(1c605d13_objs_0): CPPFLAGS += -I/root/repo/ChampSim/src
+$(1c605d13_objs_0): /root/repo/ChampSim/.bench/.csconfig/1c605d13/obj/%.o: /root/repo/ChampSim/src/%.cc | /root/repo/ChampSim/.bench/.csconfig/1c605d13/obj
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/1c605d13/obj/*.d)
+
+/root/repo/ChampSim/.bench/bin/bench_baseline: $(1c605d13_objs_0) | /root/repo/ChampSim/.bench/bin
+$(1c605d13_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/1c605d13/inc
+build_dirs += $(1c605d13_dirs_0) /root/repo/ChampSim/.bench/bin
+build_objs += $(1c605d13_objs_0)
+executable_name += /root/repo/ChampSim/.bench/bin/bench_baseline
+
+###
+# Build ID: 1c605d13_btbDbasic_btb
+# Source: /root/repo/ChampSim/btb/basic_btb
+# Destination: /root/repo/ChampSim/.bench/.csconfig/1c605d13/btbDbasic_btb
+###
+
+1c605d13_btbDbasic_btb_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/1c605d13/btbDbasic_btb
+1c605d13_btbDbasic_btb_objs_0 = $(patsubst /root/repo/ChampSim/btb/basic_btb/%.cc, /root/repo/ChampSim/.bench/.csconfig/1c605d13/btbDbasic_btb/%.o, $(wildcard /root/repo/ChampSim/btb/basic_btb/*.cc))
+$(1c605d13_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/btb/basic_btb
+$(1c605d13_btbDbasic_btb_objs_0): /root/repo/ChampSim/.bench/.csconfig/1c605d13/btbDbasic_btb/%.o: /root/repo/ChampSim/btb/basic_btb/%.cc | /root/repo/ChampSim/.bench/.csconfig/1c605d13/btbDbasic_btb
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/1c605d13/btbDbasic_btb/*.d)
+
+$(1c605d13_btbDbasic_btb_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(1c605d13_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/1c605d13/inc
+$(1c605d13_btbDbasic_btb_objs_0): CPPFLAGS += -include btbDbasic_btb.inc
+module_dirs += $(1c605d13_btbDbasic_btb_dirs_0)
+module_objs += $(1c605d13_btbDbasic_btb_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_baseline: $(1c605d13_btbDbasic_btb_objs_0)
+###
+# Build ID: 1c605d13_branchDbimodal
+# Source: /root/repo/ChampSim/branch/bimodal
+# Destination: /root/repo/ChampSim/.bench/.csconfig/1c605d13/branchDbimodal
+###
+
+1c605d13_branchDbimodal_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/1c605d13/branchDbimodal
+1c605d13_branchDbimodal_objs_0 = $(patsubst /root/repo/ChampSim/branch/bimodal/%.cc, /root/repo/ChampSim/.bench/.csconfig/1c605d13/branchDbimodal/%.o, $(wildcard /root/repo/ChampSim/branch/bimodal/*.cc))
+$(1c605d13_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/bimodal
+$(1c605d13_branchDbimodal_objs_0): /root/repo/ChampSim/.bench/.csconfig/1c605d13/branchDbimodal/%.o: /root/repo/ChampSim/branch/bimodal/%.cc | /root/repo/ChampSim/.bench/.csconfig/1c605d13/branchDbimodal
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/1c605d13/branchDbimodal/*.d)
+
+$(1c605d13_branchDbimodal_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(1c605d13_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/1c605d13/inc
+$(1c605d13_branchDbimodal_objs_0): CPPFLAGS += -include branchDbimodal.inc
+module_dirs += $(1c605d13_branchDbimodal_dirs_0)
+module_objs += $(1c605d13_branchDbimodal_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_baseline: $(1c605d13_branchDbimodal_objs_0)
+###
+# Build ID: 1c605d13_prefetcherDip_stride
+# Source: /root/repo/ChampSim/prefetcher/ip_stride
+# Destination: /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDip_stride
+###
+
+1c605d13_prefetcherDip_stride_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDip_stride
+1c605d13_prefetcherDip_stride_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/ip_stride/%.cc, /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDip_stride/%.o, $(wildcard /root/repo/ChampSim/prefetcher/ip_stride/*.cc))
+$(1c605d13_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/ip_stride
+$(1c605d13_prefetcherDip_stride_objs_0): /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDip_stride/%.o: /root/repo/ChampSim/prefetcher/ip_stride/%.cc | /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDip_stride
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDip_stride/*.d)
+
+$(1c605d13_prefetcherDip_stride_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(1c605d13_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/1c605d13/inc
+$(1c605d13_prefetcherDip_stride_objs_0): CPPFLAGS += -include prefetcherDip_stride.inc
+module_dirs += $(1c605d13_prefetcherDip_stride_dirs_0)
+module_objs += $(1c605d13_prefetcherDip_stride_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_baseline: $(1c605d13_prefetcherDip_stride_objs_0)
+###
+# Build ID: 1c605d13_prefetcherDnext_line
+# Source: /root/repo/ChampSim/prefetcher/next_line
+# Destination: /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line
+###
+
+1c605d13_prefetcherDnext_line_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line
+1c605d13_prefetcherDnext_line_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line/%.cc, /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line/*.cc))
+$(1c605d13_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line
+$(1c605d13_prefetcherDnext_line_objs_0): /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line/%.o: /root/repo/ChampSim/prefetcher/next_line/%.cc | /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line/*.d)
+
+$(1c605d13_prefetcherDnext_line_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(1c605d13_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/1c605d13/inc
+$(1c605d13_prefetcherDnext_line_objs_0): CPPFLAGS += -include prefetcherDnext_line.inc
+module_dirs += $(1c605d13_prefetcherDnext_line_dirs_0)
+module_objs += $(1c605d13_prefetcherDnext_line_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_baseline: $(1c605d13_prefetcherDnext_line_objs_0)
+###
+# Build ID: 1c605d13_prefetcherDnext_line_instr
+# Source: /root/repo/ChampSim/prefetcher/next_line_instr
+# Destination: /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line_instr
+###
+
+1c605d13_prefetcherDnext_line_instr_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line_instr
+1c605d13_prefetcherDnext_line_instr_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line_instr/%.cc, /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line_instr/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line_instr/*.cc))
+$(1c605d13_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line_instr
+$(1c605d13_prefetcherDnext_line_instr_objs_0): /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line_instr/%.o: /root/repo/ChampSim/prefetcher/next_line_instr/%.cc | /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line_instr
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDnext_line_instr/*.d)
+
+$(1c605d13_prefetcherDnext_line_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(1c605d13_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/1c605d13/inc
+$(1c605d13_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -include prefetcherDnext_line_instr.inc
+module_dirs += $(1c605d13_prefetcherDnext_line_instr_dirs_0)
+module_objs += $(1c605d13_prefetcherDnext_line_instr_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_baseline: $(1c605d13_prefetcherDnext_line_instr_objs_0)
+###
+# Build ID: 1c605d13_prefetcherDno
+# Source: /root/repo/ChampSim/prefetcher/no
+# Destination: /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDno
+###
+
+1c605d13_prefetcherDno_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDno
+1c605d13_prefetcherDno_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/no/%.cc, /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDno/%.o, $(wildcard /root/repo/ChampSim/prefetcher/no/*.cc))
+$(1c605d13_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/no
+$(1c605d13_prefetcherDno_objs_0): /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDno/%.o: /root/repo/ChampSim/prefetcher/no/%.cc | /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDno
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/1c605d13/prefetcherDno/*.d)
+
+$(1c605d13_prefetcherDno_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(1c605d13_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/1c605d13/inc
+$(1c605d13_prefetcherDno_objs_0): CPPFLAGS += -include prefetcherDno.inc
+module_dirs += $(1c605d13_prefetcherDno_dirs_0)
+module_objs += $(1c605d13_prefetcherDno_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_baseline: $(1c605d13_prefetcherDno_objs_0)
+###
+# Build ID: 1c605d13_replacementDlru
+# Source: /root/repo/ChampSim/replacement/lru
+# Destination: /root/repo/ChampSim/.bench/.csconfig/1c605d13/replacementDlru
+###
+
+1c605d13_replacementDlru_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/1c605d13/replacementDlru
+1c605d13_replacementDlru_objs_0 = $(patsubst /root/repo/ChampSim/replacement/lru/%.cc, /root/repo/ChampSim/.bench/.csconfig/1c605d13/replacementDlru/%.o, $(wildcard /root/repo/ChampSim/replacement/lru/*.cc))
+$(1c605d13_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/lru
+$(1c605d13_replacementDlru_objs_0): /root/repo/ChampSim/.bench/.csconfig/1c605d13/replacementDlru/%.o: /root/repo/ChampSim/replacement/lru/%.cc | /root/repo/ChampSim/.bench/.csconfig/1c605d13/replacementDlru
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/1c605d13/replacementDlru/*.d)
+
+$(1c605d13_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(1c605d13_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/1c605d13/inc
+$(1c605d13_replacementDlru_objs_0): CPPFLAGS += -include replacementDlru.inc
+module_dirs += $(1c605d13_replacementDlru_dirs_0)
+module_objs += $(1c605d13_replacementDlru_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_baseline: $(1c605d13_replacementDlru_objs_0)
+
+######
+# Build ID: 2e0083fb
+# Executable: /root/repo/ChampSim/.bench/bin/bench_itp
+######
+
+###
+# Build ID: 2e0083fb
+# Source: /root/repo/ChampSim/src
+# Destination: /root/repo/ChampSim/.bench/.csconfig/2e0083fb/obj
+###
+
+2e0083fb_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/2e0083fb/obj
+2e0083fb_objs_0 = $(patsubst /root/repo/ChampSim/src/%.cc, /root/repo/ChampSim/.bench/.csconfig/2e0083fb/obj/%.o, $(wildcard /root/repo/ChampSim/src/*.cc))
+$(2e0083fb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/src
+$(2e0083fb_objs_0): /root/repo/ChampSim/.bench/.csconfig/2e0083fb/obj/%.o: /root/repo/ChampSim/src/%.cc | /root/repo/ChampSim/.bench/.csconfig/2e0083fb/obj
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/2e0083fb/obj/*.d)
+
+/root/repo/ChampSim/.bench/bin/bench_itp: $(2e0083fb_objs_0) | /root/repo/ChampSim/.bench/bin
+$(2e0083fb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/2e0083fb/inc
+build_dirs += $(2e0083fb_dirs_0) /root/repo/ChampSim/.bench/bin
+build_objs += $(2e0083fb_objs_0)
+executable_name += /root/repo/ChampSim/.bench/bin/bench_itp
+
+###
+# Build ID: 2e0083fb_btbDbasic_btb
+# Source: /root/repo/ChampSim/btb/basic_btb
+# Destination: /root/repo/ChampSim/.bench/.csconfig/2e0083fb/btbDbasic_btb
+###
+
+2e0083fb_btbDbasic_btb_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/2e0083fb/btbDbasic_btb
+2e0083fb_btbDbasic_btb_objs_0 = $(patsubst /root/repo/ChampSim/btb/basic_btb/%.cc, /root/repo/ChampSim/.bench/.csconfig/2e0083fb/btbDbasic_btb/%.o, $(wildcard /root/repo/ChampSim/btb/basic_btb/*.cc))
+$(2e0083fb_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/btb/basic_btb
+$(2e0083fb_btbDbasic_btb_objs_0): /root/repo/ChampSim/.bench/.csconfig/2e0083fb/btbDbasic_btb/%.o: /root/repo/ChampSim/btb/basic_btb/%.cc | /root/repo/ChampSim/.bench/.csconfig/2e0083fb/btbDbasic_btb
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/2e0083fb/btbDbasic_btb/*.d)
+
+$(2e0083fb_btbDbasic_btb_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(2e0083fb_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/2e0083fb/inc
+$(2e0083fb_btbDbasic_btb_objs_0): CPPFLAGS += -include btbDbasic_btb.inc
+module_dirs += $(2e0083fb_btbDbasic_btb_dirs_0)
+module_objs += $(2e0083fb_btbDbasic_btb_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_itp: $(2e0083fb_btbDbasic_btb_objs_0)
+###
+# Build ID: 2e0083fb_branchDbimodal
+# Source: /root/repo/ChampSim/branch/bimodal
+# Destination: /root/repo/ChampSim/.bench/.csconfig/2e0083fb/branchDbimodal
+###
+
+2e0083fb_branchDbimodal_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/2e0083fb/branchDbimodal
+2e0083fb_branchDbimodal_objs_0 = $(patsubst /root/repo/ChampSim/branch/bimodal/%.cc, /root/repo/ChampSim/.bench/.csconfig/2e0083fb/branchDbimodal/%.o, $(wildcard /root/repo/ChampSim/branch/bimodal/*.cc))
+$(2e0083fb_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/bimodal
+$(2e0083fb_branchDbimodal_objs_0): /root/repo/ChampSim/.bench/.csconfig/2e0083fb/branchDbimodal/%.o: /root/repo/ChampSim/branch/bimodal/%.cc | /root/repo/ChampSim/.bench/.csconfig/2e0083fb/branchDbimodal
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/2e0083fb/branchDbimodal/*.d)
+
+$(2e0083fb_branchDbimodal_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(2e0083fb_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/2e0083fb/inc
+$(2e0083fb_branchDbimodal_objs_0): CPPFLAGS += -include branchDbimodal.inc
+module_dirs += $(2e0083fb_branchDbimodal_dirs_0)
+module_objs += $(2e0083fb_branchDbimodal_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_itp: $(2e0083fb_branchDbimodal_objs_0)
+###
+# Build ID: 2e0083fb_prefetcherDip_stride
+# Source: /root/repo/ChampSim/prefetcher/ip_stride
+# Destination: /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDip_stride
+###
+
+2e0083fb_prefetcherDip_stride_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDip_stride
+2e0083fb_prefetcherDip_stride_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/ip_stride/%.cc, /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDip_stride/%.o, $(wildcard /root/repo/ChampSim/prefetcher/ip_stride/*.cc))
+$(2e0083fb_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/ip_stride
+$(2e0083fb_prefetcherDip_stride_objs_0): /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDip_stride/%.o: /root/repo/ChampSim/prefetcher/ip_stride/%.cc | /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDip_stride
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDip_stride/*.d)
+
+$(2e0083fb_prefetcherDip_stride_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(2e0083fb_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/2e0083fb/inc
+$(2e0083fb_prefetcherDip_stride_objs_0): CPPFLAGS += -include prefetcherDip_stride.inc
+module_dirs += $(2e0083fb_prefetcherDip_stride_dirs_0)
+module_objs += $(2e0083fb_prefetcherDip_stride_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_itp: $(2e0083fb_prefetcherDip_stride_objs_0)
+###
+# Build ID: 2e0083fb_prefetcherDnext_line
+# Source: /root/repo/ChampSim/prefetcher/next_line
+# Destination: /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line
+###
+
+2e0083fb_prefetcherDnext_line_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line
+2e0083fb_prefetcherDnext_line_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line/%.cc, /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line/*.cc))
+$(2e0083fb_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line
+$(2e0083fb_prefetcherDnext_line_objs_0): /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line/%.o: /root/repo/ChampSim/prefetcher/next_line/%.cc | /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line/*.d)
+
+$(2e0083fb_prefetcherDnext_line_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(2e0083fb_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/2e0083fb/inc
+$(2e0083fb_prefetcherDnext_line_objs_0): CPPFLAGS += -include prefetcherDnext_line.inc
+module_dirs += $(2e0083fb_prefetcherDnext_line_dirs_0)
+module_objs += $(2e0083fb_prefetcherDnext_line_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_itp: $(2e0083fb_prefetcherDnext_line_objs_0)
+###
+# Build ID: 2e0083fb_prefetcherDnext_line_instr
+# Source: /root/repo/ChampSim/prefetcher/next_line_instr
+# Destination: /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line_instr
+###
+
+2e0083fb_prefetcherDnext_line_instr_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line_instr
+2e0083fb_prefetcherDnext_line_instr_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line_instr/%.cc, /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line_instr/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line_instr/*.cc))
+$(2e0083fb_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line_instr
+$(2e0083fb_prefetcherDnext_line_instr_objs_0): /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line_instr/%.o: /root/repo/ChampSim/prefetcher/next_line_instr/%.cc | /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line_instr
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDnext_line_instr/*.d)
+
+$(2e0083fb_prefetcherDnext_line_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(2e0083fb_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/2e0083fb/inc
+$(2e0083fb_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -include prefetcherDnext_line_instr.inc
+module_dirs += $(2e0083fb_prefetcherDnext_line_instr_dirs_0)
+module_objs += $(2e0083fb_prefetcherDnext_line_instr_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_itp: $(2e0083fb_prefetcherDnext_line_instr_objs_0)
+###
+# Build ID: 2e0083fb_prefetcherDno
+# Source: /root/repo/ChampSim/prefetcher/no
+# Destination: /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDno
+###
+
+2e0083fb_prefetcherDno_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDno
+2e0083fb_prefetcherDno_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/no/%.cc, /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDno/%.o, $(wildcard /root/repo/ChampSim/prefetcher/no/*.cc))
+$(2e0083fb_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/no
+$(2e0083fb_prefetcherDno_objs_0): /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDno/%.o: /root/repo/ChampSim/prefetcher/no/%.cc | /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDno
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/2e0083fb/prefetcherDno/*.d)
+
+$(2e0083fb_prefetcherDno_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(2e0083fb_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/2e0083fb/inc
+$(2e0083fb_prefetcherDno_objs_0): CPPFLAGS += -include prefetcherDno.inc
+module_dirs += $(2e0083fb_prefetcherDno_dirs_0)
+module_objs += $(2e0083fb_prefetcherDno_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_itp: $(2e0083fb_prefetcherDno_objs_0)
+###
+# Build ID: 2e0083fb_replacementDitp
+# Source: /root/repo/ChampSim/replacement/itp
+# Destination: /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDitp
+###
+
+2e0083fb_replacementDitp_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDitp
+2e0083fb_replacementDitp_objs_0 = $(patsubst /root/repo/ChampSim/replacement/itp/%.cc, /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDitp/%.o, $(wildcard /root/repo/ChampSim/replacement/itp/*.cc))
+$(2e0083fb_replacementDitp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/itp
+$(2e0083fb_replacementDitp_objs_0): /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDitp/%.o: /root/repo/ChampSim/replacement/itp/%.cc | /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDitp
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDitp/*.d)
+
+$(2e0083fb_replacementDitp_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(2e0083fb_replacementDitp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/2e0083fb/inc
+$(2e0083fb_replacementDitp_objs_0): CPPFLAGS += -include replacementDitp.inc
+module_dirs += $(2e0083fb_replacementDitp_dirs_0)
+module_objs += $(2e0083fb_replacementDitp_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_itp: $(2e0083fb_replacementDitp_objs_0)
+###
+# Build ID: 2e0083fb_replacementDlru
+# Source: /root/repo/ChampSim/replacement/lru
+# Destination: /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDlru
+###
+
+2e0083fb_replacementDlru_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDlru
+2e0083fb_replacementDlru_objs_0 = $(patsubst /root/repo/ChampSim/replacement/lru/%.cc, /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDlru/%.o, $(wildcard /root/repo/ChampSim/replacement/lru/*.cc))
+$(2e0083fb_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/lru
+$(2e0083fb_replacementDlru_objs_0): /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDlru/%.o: /root/repo/ChampSim/replacement/lru/%.cc | /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDlru
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/2e0083fb/replacementDlru/*.d)
+
+$(2e0083fb_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(2e0083fb_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/2e0083fb/inc
+$(2e0083fb_replacementDlru_objs_0): CPPFLAGS += -include replacementDlru.inc
+module_dirs += $(2e0083fb_replacementDlru_dirs_0)
+module_objs += $(2e0083fb_replacementDlru_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_itp: $(2e0083fb_replacementDlru_objs_0)
+
+######
+# Build ID: d278d23c
+# Executable: /root/repo/ChampSim/.bench/bin/bench_xptp
+######
+
+###
+# Build ID: d278d23c
+# Source: /root/repo/ChampSim/src
+# Destination: /root/repo/ChampSim/.bench/.csconfig/d278d23c/obj
+###
+
+d278d23c_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/d278d23c/obj
+d278d23c_objs_0 = $(patsubst /root/repo/ChampSim/src/%.cc, /root/repo/ChampSim/.bench/.csconfig/d278d23c/obj/%.o, $(wildcard /root/repo/ChampSim/src/*.cc))
+$(d278d23c_objs_0): CPPFLAGS += -I/root/repo/ChampSim/src
+$(d278d23c_objs_0): /root/repo/ChampSim/.bench/.csconfig/d278d23c/obj/%.o: /root/repo/ChampSim/src/%.cc | /root/repo/ChampSim/.bench/.csconfig/d278d23c/obj
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/d278d23c/obj/*.d)
+
+/root/repo/ChampSim/.bench/bin/bench_xptp: $(d278d23c_objs_0) | /root/repo/ChampSim/.bench/bin
+$(d278d23c_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/d278d23c/inc
+build_dirs += $(d278d23c_dirs_0) /root/repo/ChampSim/.bench/bin
+build_objs += $(d278d23c_objs_0)
+executable_name += /root/repo/ChampSim/.bench/bin/bench_xptp
+
+###
+# Build ID: d278d23c_btbDbasic_btb
+# Source: /root/repo/ChampSim/btb/basic_btb
+# Destination: /root/repo/ChampSim/.bench/.csconfig/d278d23c/btbDbasic_btb
+###
+
+d278d23c_btbDbasic_btb_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/d278d23c/btbDbasic_btb
+d278d23c_btbDbasic_btb_objs_0 = $(patsubst /root/repo/ChampSim/btb/basic_btb/%.cc, /root/repo/ChampSim/.bench/.csconfig/d278d23c/btbDbasic_btb/%.o, $(wildcard /root/repo/ChampSim/btb/basic_btb/*.cc))
+$(d278d23c_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/btb/basic_btb
+$(d278d23c_btbDbasic_btb_objs_0): /root/repo/ChampSim/.bench/.csconfig/d278d23c/btbDbasic_btb/%.o: /root/repo/ChampSim/btb/basic_btb/%.cc | /root/repo/ChampSim/.bench/.csconfig/d278d23c/btbDbasic_btb
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/d278d23c/btbDbasic_btb/*.d)
+
+$(d278d23c_btbDbasic_btb_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(d278d23c_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/d278d23c/inc
+$(d278d23c_btbDbasic_btb_objs_0): CPPFLAGS += -include btbDbasic_btb.inc
+module_dirs += $(d278d23c_btbDbasic_btb_dirs_0)
+module_objs += $(d278d23c_btbDbasic_btb_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_xptp: $(d278d23c_btbDbasic_btb_objs_0)
+###
+# Build ID: d278d23c_branchDbimodal
+# Source: /root/repo/ChampSim/branch/bimodal
+# Destination: /root/repo/ChampSim/.bench/.csconfig/d278d23c/branchDbimodal
+###
+
+d278d23c_branchDbimodal_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/d278d23c/branchDbimodal
+d278d23c_branchDbimodal_objs_0 = $(patsubst /root/repo/ChampSim/branch/bimodal/%.cc, /root/repo/ChampSim/.bench/.csconfig/d278d23c/branchDbimodal/%.o, $(wildcard /root/repo/ChampSim/branch/bimodal/*.cc))
+$(d278d23c_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/bimodal
+$(d278d23c_branchDbimodal_objs_0): /root/repo/ChampSim/.bench/.csconfig/d278d23c/branchDbimodal/%.o: /root/repo/ChampSim/branch/bimodal/%.cc | /root/repo/ChampSim/.bench/.csconfig/d278d23c/branchDbimodal
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/d278d23c/branchDbimodal/*.d)
+
+$(d278d23c_branchDbimodal_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(d278d23c_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/d278d23c/inc
+$(d278d23c_branchDbimodal_objs_0): CPPFLAGS += -include branchDbimodal.inc
+module_dirs += $(d278d23c_branchDbimodal_dirs_0)
+module_objs += $(d278d23c_branchDbimodal_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_xptp: $(d278d23c_branchDbimodal_objs_0)
+###
+# Build ID: d278d23c_prefetcherDip_stride
+# Source: /root/repo/ChampSim/prefetcher/ip_stride
+# Destination: /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDip_stride
+###
+
+d278d23c_prefetcherDip_stride_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDip_stride
+d278d23c_prefetcherDip_stride_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/ip_stride/%.cc, /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDip_stride/%.o, $(wildcard /root/repo/ChampSim/prefetcher/ip_stride/*.cc))
+$(d278d23c_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/ip_stride
+$(d278d23c_prefetcherDip_stride_objs_0): /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDip_stride/%.o: /root/repo/ChampSim/prefetcher/ip_stride/%.cc | /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDip_stride
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDip_stride/*.d)
+
+$(d278d23c_prefetcherDip_stride_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(d278d23c_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/d278d23c/inc
+$(d278d23c_prefetcherDip_stride_objs_0): CPPFLAGS += -include prefetcherDip_stride.inc
+module_dirs += $(d278d23c_prefetcherDip_stride_dirs_0)
+module_objs += $(d278d23c_prefetcherDip_stride_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_xptp: $(d278d23c_prefetcherDip_stride_objs_0)
+###
+# Build ID: d278d23c_prefetcherDnext_line
+# Source: /root/repo/ChampSim/prefetcher/next_line
+# Destination: /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line
+###
+
+d278d23c_prefetcherDnext_line_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line
+d278d23c_prefetcherDnext_line_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line/%.cc, /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line/*.cc))
+$(d278d23c_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line
+$(d278d23c_prefetcherDnext_line_objs_0): /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line/%.o: /root/repo/ChampSim/prefetcher/next_line/%.cc | /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line/*.d)
+
+$(d278d23c_prefetcherDnext_line_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(d278d23c_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/d278d23c/inc
+$(d278d23c_prefetcherDnext_line_objs_0): CPPFLAGS += -include prefetcherDnext_line.inc
+module_dirs += $(d278d23c_prefetcherDnext_line_dirs_0)
+module_objs += $(d278d23c_prefetcherDnext_line_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_xptp: $(d278d23c_prefetcherDnext_line_objs_0)
+###
+# Build ID: d278d23c_prefetcherDnext_line_instr
+# Source: /root/repo/ChampSim/prefetcher/next_line_instr
+# Destination: /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line_instr
+###
+
+d278d23c_prefetcherDnext_line_instr_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line_instr
+d278d23c_prefetcherDnext_line_instr_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line_instr/%.cc, /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line_instr/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line_instr/*.cc))
+$(d278d23c_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line_instr
+$(d278d23c_prefetcherDnext_line_instr_objs_0): /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line_instr/%.o: /root/repo/ChampSim/prefetcher/next_line_instr/%.cc | /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line_instr
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDnext_line_instr/*.d)
+
+$(d278d23c_prefetcherDnext_line_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(d278d23c_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/d278d23c/inc
+$(d278d23c_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -include prefetcherDnext_line_instr.inc
+module_dirs += $(d278d23c_prefetcherDnext_line_instr_dirs_0)
+module_objs += $(d278d23c_prefetcherDnext_line_instr_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_xptp: $(d278d23c_prefetcherDnext_line_instr_objs_0)
+###
+# Build ID: d278d23c_prefetcherDno
+# Source: /root/repo/ChampSim/prefetcher/no
+# Destination: /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDno
+###
+
+d278d23c_prefetcherDno_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDno
+d278d23c_prefetcherDno_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/no/%.cc, /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDno/%.o, $(wildcard /root/repo/ChampSim/prefetcher/no/*.cc))
+$(d278d23c_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/no
+$(d278d23c_prefetcherDno_objs_0): /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDno/%.o: /root/repo/ChampSim/prefetcher/no/%.cc | /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDno
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/d278d23c/prefetcherDno/*.d)
+
+$(d278d23c_prefetcherDno_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(d278d23c_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/d278d23c/inc
+$(d278d23c_prefetcherDno_objs_0): CPPFLAGS += -include prefetcherDno.inc
+module_dirs += $(d278d23c_prefetcherDno_dirs_0)
+module_objs += $(d278d23c_prefetcherDno_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_xptp: $(d278d23c_prefetcherDno_objs_0)
+###
+# Build ID: d278d23c_replacementDitp
+# Source: /root/repo/ChampSim/replacement/itp
+# Destination: /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDitp
+###
+
+d278d23c_replacementDitp_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDitp
+d278d23c_replacementDitp_objs_0 = $(patsubst /root/repo/ChampSim/replacement/itp/%.cc, /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDitp/%.o, $(wildcard /root/repo/ChampSim/replacement/itp/*.cc))
+$(d278d23c_replacementDitp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/itp
+$(d278d23c_replacementDitp_objs_0): /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDitp/%.o: /root/repo/ChampSim/replacement/itp/%.cc | /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDitp
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDitp/*.d)
+
+$(d278d23c_replacementDitp_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(d278d23c_replacementDitp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/d278d23c/inc
+$(d278d23c_replacementDitp_objs_0): CPPFLAGS += -include replacementDitp.inc
+module_dirs += $(d278d23c_replacementDitp_dirs_0)
+module_objs += $(d278d23c_replacementDitp_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_xptp: $(d278d23c_replacementDitp_objs_0)
+###
+# Build ID: d278d23c_replacementDlru
+# Source: /root/repo/ChampSim/replacement/lru
+# Destination: /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDlru
+###
+
+d278d23c_replacementDlru_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDlru
+d278d23c_replacementDlru_objs_0 = $(patsubst /root/repo/ChampSim/replacement/lru/%.cc, /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDlru/%.o, $(wildcard /root/repo/ChampSim/replacement/lru/*.cc))
+$(d278d23c_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/lru
+$(d278d23c_replacementDlru_objs_0): /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDlru/%.o: /root/repo/ChampSim/replacement/lru/%.cc | /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDlru
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDlru/*.d)
+
+$(d278d23c_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(d278d23c_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/d278d23c/inc
+$(d278d23c_replacementDlru_objs_0): CPPFLAGS += -include replacementDlru.inc
+module_dirs += $(d278d23c_replacementDlru_dirs_0)
+module_objs += $(d278d23c_replacementDlru_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_xptp: $(d278d23c_replacementDlru_objs_0)
+###
+# Build ID: d278d23c_replacementDxptp
+# Source: /root/repo/ChampSim/replacement/xptp
+# Destination: /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDxptp
+###
+
+d278d23c_replacementDxptp_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDxptp
+d278d23c_replacementDxptp_objs_0 = $(patsubst /root/repo/ChampSim/replacement/xptp/%.cc, /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDxptp/%.o, $(wildcard /root/repo/ChampSim/replacement/xptp/*.cc))
+$(d278d23c_replacementDxptp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/xptp
+$(d278d23c_replacementDxptp_objs_0): /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDxptp/%.o: /root/repo/ChampSim/replacement/xptp/%.cc | /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDxptp
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/d278d23c/replacementDxptp/*.d)
+
+$(d278d23c_replacementDxptp_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(d278d23c_replacementDxptp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/d278d23c/inc
+$(d278d23c_replacementDxptp_objs_0): CPPFLAGS += -include replacementDxptp.inc
+module_dirs += $(d278d23c_replacementDxptp_dirs_0)
+module_objs += $(d278d23c_replacementDxptp_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_xptp: $(d278d23c_replacementDxptp_objs_0)
+
+######
+# Build ID: 892f6699
+# Executable: /root/repo/ChampSim/.bench/bin/bench_multicore
+######
+
+###
+# Build ID: 892f6699
+# Source: /root/repo/ChampSim/src
+# Destination: /root/repo/ChampSim/.bench/.csconfig/892f6699/obj
+###
+
+892f6699_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/892f6699/obj
+892f6699_objs_0 = $(patsubst /root/repo/ChampSim/src/%.cc, /root/repo/ChampSim/.bench/.csconfig/892f6699/obj/%.o, $(wildcard /root/repo/ChampSim/src/*.cc))
+$(892f6699_objs_0): CPPFLAGS += -I/root/repo/ChampSim/src
+$(892f6699_objs_0): /root/repo/ChampSim/.bench/.csconfig/892f6699/obj/%.o: /root/repo/ChampSim/src/%.cc | /root/repo/ChampSim/.bench/.csconfig/892f6699/obj
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/892f6699/obj/*.d)
+
+/root/repo/ChampSim/.bench/bin/bench_multicore: $(892f6699_objs_0) | /root/repo/ChampSim/.bench/bin
+$(892f6699_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/892f6699/inc
+build_dirs += $(892f6699_dirs_0) /root/repo/ChampSim/.bench/bin
+build_objs += $(892f6699_objs_0)
+executable_name += /root/repo/ChampSim/.bench/bin/bench_multicore
+
+###
+# Build ID: 892f6699_btbDbasic_btb
+# Source: /root/repo/ChampSim/btb/basic_btb
+# Destination: /root/repo/ChampSim/.bench/.csconfig/892f6699/btbDbasic_btb
+###
+
+892f6699_btbDbasic_btb_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/892f6699/btbDbasic_btb
+892f6699_btbDbasic_btb_objs_0 = $(patsubst /root/repo/ChampSim/btb/basic_btb/%.cc, /root/repo/ChampSim/.bench/.csconfig/892f6699/btbDbasic_btb/%.o, $(wildcard /root/repo/ChampSim/btb/basic_btb/*.cc))
+$(892f6699_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/btb/basic_btb
+$(892f6699_btbDbasic_btb_objs_0): /root/repo/ChampSim/.bench/.csconfig/892f6699/btbDbasic_btb/%.o: /root/repo/ChampSim/btb/basic_btb/%.cc | /root/repo/ChampSim/.bench/.csconfig/892f6699/btbDbasic_btb
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/892f6699/btbDbasic_btb/*.d)
+
+$(892f6699_btbDbasic_btb_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(892f6699_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/892f6699/inc
+$(892f6699_btbDbasic_btb_objs_0): CPPFLAGS += -include btbDbasic_btb.inc
+module_dirs += $(892f6699_btbDbasic_btb_dirs_0)
+module_objs += $(892f6699_btbDbasic_btb_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_multicore: $(892f6699_btbDbasic_btb_objs_0)
+###
+# Build ID: 892f6699_branchDbimodal
+# Source: /root/repo/ChampSim/branch/bimodal
+# Destination: /root/repo/ChampSim/.bench/.csconfig/892f6699/branchDbimodal
+###
+
+892f6699_branchDbimodal_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/892f6699/branchDbimodal
+892f6699_branchDbimodal_objs_0 = $(patsubst /root/repo/ChampSim/branch/bimodal/%.cc, /root/repo/ChampSim/.bench/.csconfig/892f6699/branchDbimodal/%.o, $(wildcard /root/repo/ChampSim/branch/bimodal/*.cc))
+$(892f6699_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/bimodal
+$(892f6699_branchDbimodal_objs_0): /root/repo/ChampSim/.bench/.csconfig/892f6699/branchDbimodal/%.o: /root/repo/ChampSim/branch/bimodal/%.cc | /root/repo/ChampSim/.bench/.csconfig/892f6699/branchDbimodal
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/892f6699/branchDbimodal/*.d)
+
+$(892f6699_branchDbimodal_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(892f6699_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/892f6699/inc
+$(892f6699_branchDbimodal_objs_0): CPPFLAGS += -include branchDbimodal.inc
+module_dirs += $(892f6699_branchDbimodal_dirs_0)
+module_objs += $(892f6699_branchDbimodal_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_multicore: $(892f6699_branchDbimodal_objs_0)
+###
+# Build ID: 892f6699_prefetcherDip_stride
+# Source: /root/repo/ChampSim/prefetcher/ip_stride
+# Destination: /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDip_stride
+###
+
+892f6699_prefetcherDip_stride_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDip_stride
+892f6699_prefetcherDip_stride_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/ip_stride/%.cc, /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDip_stride/%.o, $(wildcard /root/repo/ChampSim/prefetcher/ip_stride/*.cc))
+$(892f6699_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/ip_stride
+$(892f6699_prefetcherDip_stride_objs_0): /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDip_stride/%.o: /root/repo/ChampSim/prefetcher/ip_stride/%.cc | /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDip_stride
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDip_stride/*.d)
+
+$(892f6699_prefetcherDip_stride_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(892f6699_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/892f6699/inc
+$(892f6699_prefetcherDip_stride_objs_0): CPPFLAGS += -include prefetcherDip_stride.inc
+module_dirs += $(892f6699_prefetcherDip_stride_dirs_0)
+module_objs += $(892f6699_prefetcherDip_stride_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_multicore: $(892f6699_prefetcherDip_stride_objs_0)
+###
+# Build ID: 892f6699_prefetcherDnext_line
+# Source: /root/repo/ChampSim/prefetcher/next_line
+# Destination: /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line
+###
+
+892f6699_prefetcherDnext_line_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line
+892f6699_prefetcherDnext_line_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line/%.cc, /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line/*.cc))
+$(892f6699_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line
+$(892f6699_prefetcherDnext_line_objs_0): /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line/%.o: /root/repo/ChampSim/prefetcher/next_line/%.cc | /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line/*.d)
+
+$(892f6699_prefetcherDnext_line_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(892f6699_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/892f6699/inc
+$(892f6699_prefetcherDnext_line_objs_0): CPPFLAGS += -include prefetcherDnext_line.inc
+module_dirs += $(892f6699_prefetcherDnext_line_dirs_0)
+module_objs += $(892f6699_prefetcherDnext_line_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_multicore: $(892f6699_prefetcherDnext_line_objs_0)
+###
+# Build ID: 892f6699_prefetcherDnext_line_instr
+# Source: /root/repo/ChampSim/prefetcher/next_line_instr
+# Destination: /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line_instr
+###
+
+892f6699_prefetcherDnext_line_instr_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line_instr
+892f6699_prefetcherDnext_line_instr_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line_instr/%.cc, /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line_instr/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line_instr/*.cc))
+$(892f6699_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line_instr
+$(892f6699_prefetcherDnext_line_instr_objs_0): /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line_instr/%.o: /root/repo/ChampSim/prefetcher/next_line_instr/%.cc | /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line_instr
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDnext_line_instr/*.d)
+
+$(892f6699_prefetcherDnext_line_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(892f6699_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/892f6699/inc
+$(892f6699_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -include prefetcherDnext_line_instr.inc
+module_dirs += $(892f6699_prefetcherDnext_line_instr_dirs_0)
+module_objs += $(892f6699_prefetcherDnext_line_instr_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_multicore: $(892f6699_prefetcherDnext_line_instr_objs_0)
+###
+# Build ID: 892f6699_prefetcherDno
+# Source: /root/repo/ChampSim/prefetcher/no
+# Destination: /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDno
+###
+
+892f6699_prefetcherDno_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDno
+892f6699_prefetcherDno_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/no/%.cc, /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDno/%.o, $(wildcard /root/repo/ChampSim/prefetcher/no/*.cc))
+$(892f6699_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/no
+$(892f6699_prefetcherDno_objs_0): /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDno/%.o: /root/repo/ChampSim/prefetcher/no/%.cc | /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDno
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/892f6699/prefetcherDno/*.d)
+
+$(892f6699_prefetcherDno_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(892f6699_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/892f6699/inc
+$(892f6699_prefetcherDno_objs_0): CPPFLAGS += -include prefetcherDno.inc
+module_dirs += $(892f6699_prefetcherDno_dirs_0)
+module_objs += $(892f6699_prefetcherDno_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_multicore: $(892f6699_prefetcherDno_objs_0)
+###
+# Build ID: 892f6699_replacementDlru
+# Source: /root/repo/ChampSim/replacement/lru
+# Destination: /root/repo/ChampSim/.bench/.csconfig/892f6699/replacementDlru
+###
+
+892f6699_replacementDlru_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/892f6699/replacementDlru
+892f6699_replacementDlru_objs_0 = $(patsubst /root/repo/ChampSim/replacement/lru/%.cc, /root/repo/ChampSim/.bench/.csconfig/892f6699/replacementDlru/%.o, $(wildcard /root/repo/ChampSim/replacement/lru/*.cc))
+$(892f6699_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/lru
+$(892f6699_replacementDlru_objs_0): /root/repo/ChampSim/.bench/.csconfig/892f6699/replacementDlru/%.o: /root/repo/ChampSim/replacement/lru/%.cc | /root/repo/ChampSim/.bench/.csconfig/892f6699/replacementDlru
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/892f6699/replacementDlru/*.d)
+
+$(892f6699_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(892f6699_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/892f6699/inc
+$(892f6699_replacementDlru_objs_0): CPPFLAGS += -include replacementDlru.inc
+module_dirs += $(892f6699_replacementDlru_dirs_0)
+module_objs += $(892f6699_replacementDlru_objs_0)
+
+/root/repo/ChampSim/.bench/bin/bench_multicore: $(892f6699_replacementDlru_objs_0)
+
+######
+# Build ID: 18218f9f
+# Executable: /root/repo/ChampSim/test/bin/000-test-main
+######
+
+###
+# Build ID: 18218f9f
+# Source: /root/repo/ChampSim/src
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/obj
+###
+
+18218f9f_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/obj
+18218f9f_objs_0 = $(patsubst /root/repo/ChampSim/src/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/obj/%.o, $(wildcard /root/repo/ChampSim/src/*.cc))
+$(18218f9f_objs_0): CPPFLAGS += -I/root/repo/ChampSim/src
+$(18218f9f_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/obj/%.o: /root/repo/ChampSim/src/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/obj
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/obj/*.d)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_objs_0) | /root/repo/ChampSim/test/bin
+$(18218f9f_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+build_dirs += $(18218f9f_dirs_0) /root/repo/ChampSim/test/bin
+build_objs += $(18218f9f_objs_0)
+executable_name += /root/repo/ChampSim/test/bin/000-test-main
+
+###
+# Build ID: 18218f9f_btbDbasic_btb
+# Source: /root/repo/ChampSim/btb/basic_btb
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/btbDbasic_btb
+###
+
+18218f9f_btbDbasic_btb_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/btbDbasic_btb
+18218f9f_btbDbasic_btb_objs_0 = $(patsubst /root/repo/ChampSim/btb/basic_btb/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/btbDbasic_btb/%.o, $(wildcard /root/repo/ChampSim/btb/basic_btb/*.cc))
+$(18218f9f_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/btb/basic_btb
+$(18218f9f_btbDbasic_btb_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/btbDbasic_btb/%.o: /root/repo/ChampSim/btb/basic_btb/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/btbDbasic_btb
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/btbDbasic_btb/*.d)
+
+$(18218f9f_btbDbasic_btb_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_btbDbasic_btb_objs_0): CPPFLAGS += -include btbDbasic_btb.inc
+module_dirs += $(18218f9f_btbDbasic_btb_dirs_0)
+module_objs += $(18218f9f_btbDbasic_btb_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_btbDbasic_btb_objs_0)
+###
+# Build ID: 18218f9f_branchDbimodal
+# Source: /root/repo/ChampSim/branch/bimodal
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDbimodal
+###
+
+18218f9f_branchDbimodal_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDbimodal
+18218f9f_branchDbimodal_objs_0 = $(patsubst /root/repo/ChampSim/branch/bimodal/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDbimodal/%.o, $(wildcard /root/repo/ChampSim/branch/bimodal/*.cc))
+$(18218f9f_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/bimodal
+$(18218f9f_branchDbimodal_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDbimodal/%.o: /root/repo/ChampSim/branch/bimodal/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDbimodal
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDbimodal/*.d)
+
+$(18218f9f_branchDbimodal_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_branchDbimodal_objs_0): CPPFLAGS += -include branchDbimodal.inc
+module_dirs += $(18218f9f_branchDbimodal_dirs_0)
+module_objs += $(18218f9f_branchDbimodal_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_branchDbimodal_objs_0)
+###
+# Build ID: 18218f9f_branchDgshare
+# Source: /root/repo/ChampSim/branch/gshare
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDgshare
+###
+
+18218f9f_branchDgshare_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDgshare
+18218f9f_branchDgshare_objs_0 = $(patsubst /root/repo/ChampSim/branch/gshare/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDgshare/%.o, $(wildcard /root/repo/ChampSim/branch/gshare/*.cc))
+$(18218f9f_branchDgshare_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/gshare
+$(18218f9f_branchDgshare_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDgshare/%.o: /root/repo/ChampSim/branch/gshare/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDgshare
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDgshare/*.d)
+
+$(18218f9f_branchDgshare_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_branchDgshare_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_branchDgshare_objs_0): CPPFLAGS += -include branchDgshare.inc
+module_dirs += $(18218f9f_branchDgshare_dirs_0)
+module_objs += $(18218f9f_branchDgshare_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_branchDgshare_objs_0)
+###
+# Build ID: 18218f9f_branchDhashed_perceptron
+# Source: /root/repo/ChampSim/branch/hashed_perceptron
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDhashed_perceptron
+###
+
+18218f9f_branchDhashed_perceptron_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDhashed_perceptron
+18218f9f_branchDhashed_perceptron_objs_0 = $(patsubst /root/repo/ChampSim/branch/hashed_perceptron/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDhashed_perceptron/%.o, $(wildcard /root/repo/ChampSim/branch/hashed_perceptron/*.cc))
+$(18218f9f_branchDhashed_perceptron_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/hashed_perceptron
+$(18218f9f_branchDhashed_perceptron_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDhashed_perceptron/%.o: /root/repo/ChampSim/branch/hashed_perceptron/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDhashed_perceptron
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDhashed_perceptron/*.d)
+
+$(18218f9f_branchDhashed_perceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_branchDhashed_perceptron_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_branchDhashed_perceptron_objs_0): CPPFLAGS += -include branchDhashed_perceptron.inc
+module_dirs += $(18218f9f_branchDhashed_perceptron_dirs_0)
+module_objs += $(18218f9f_branchDhashed_perceptron_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_branchDhashed_perceptron_objs_0)
+###
+# Build ID: 18218f9f_branchDperceptron
+# Source: /root/repo/ChampSim/branch/perceptron
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDperceptron
+###
+
+18218f9f_branchDperceptron_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDperceptron
+18218f9f_branchDperceptron_objs_0 = $(patsubst /root/repo/ChampSim/branch/perceptron/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDperceptron/%.o, $(wildcard /root/repo/ChampSim/branch/perceptron/*.cc))
+$(18218f9f_branchDperceptron_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/perceptron
+$(18218f9f_branchDperceptron_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDperceptron/%.o: /root/repo/ChampSim/branch/perceptron/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDperceptron
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/branchDperceptron/*.d)
+
+$(18218f9f_branchDperceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_branchDperceptron_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_branchDperceptron_objs_0): CPPFLAGS += -include branchDperceptron.inc
+module_dirs += $(18218f9f_branchDperceptron_dirs_0)
+module_objs += $(18218f9f_branchDperceptron_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_branchDperceptron_objs_0)
+###
+# Build ID: 18218f9f_prefetcherDip_stride
+# Source: /root/repo/ChampSim/prefetcher/ip_stride
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDip_stride
+###
+
+18218f9f_prefetcherDip_stride_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDip_stride
+18218f9f_prefetcherDip_stride_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/ip_stride/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDip_stride/%.o, $(wildcard /root/repo/ChampSim/prefetcher/ip_stride/*.cc))
+$(18218f9f_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/ip_stride
+$(18218f9f_prefetcherDip_stride_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDip_stride/%.o: /root/repo/ChampSim/prefetcher/ip_stride/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDip_stride
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDip_stride/*.d)
+
+$(18218f9f_prefetcherDip_stride_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_prefetcherDip_stride_objs_0): CPPFLAGS += -include prefetcherDip_stride.inc
+module_dirs += $(18218f9f_prefetcherDip_stride_dirs_0)
+module_objs += $(18218f9f_prefetcherDip_stride_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_prefetcherDip_stride_objs_0)
+###
+# Build ID: 18218f9f_prefetcherDnext_line
+# Source: /root/repo/ChampSim/prefetcher/next_line
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line
+###
+
+18218f9f_prefetcherDnext_line_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line
+18218f9f_prefetcherDnext_line_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line/*.cc))
+$(18218f9f_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line
+$(18218f9f_prefetcherDnext_line_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line/%.o: /root/repo/ChampSim/prefetcher/next_line/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line/*.d)
+
+$(18218f9f_prefetcherDnext_line_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_prefetcherDnext_line_objs_0): CPPFLAGS += -include prefetcherDnext_line.inc
+module_dirs += $(18218f9f_prefetcherDnext_line_dirs_0)
+module_objs += $(18218f9f_prefetcherDnext_line_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_prefetcherDnext_line_objs_0)
+###
+# Build ID: 18218f9f_prefetcherDnext_line_instr
+# Source: /root/repo/ChampSim/prefetcher/next_line_instr
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line_instr
+###
+
+18218f9f_prefetcherDnext_line_instr_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line_instr
+18218f9f_prefetcherDnext_line_instr_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line_instr/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line_instr/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line_instr/*.cc))
+$(18218f9f_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line_instr
+$(18218f9f_prefetcherDnext_line_instr_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line_instr/%.o: /root/repo/ChampSim/prefetcher/next_line_instr/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line_instr
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDnext_line_instr/*.d)
+
+$(18218f9f_prefetcherDnext_line_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -include prefetcherDnext_line_instr.inc
+module_dirs += $(18218f9f_prefetcherDnext_line_instr_dirs_0)
+module_objs += $(18218f9f_prefetcherDnext_line_instr_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_prefetcherDnext_line_instr_objs_0)
+###
+# Build ID: 18218f9f_prefetcherDno
+# Source: /root/repo/ChampSim/prefetcher/no
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno
+###
+
+18218f9f_prefetcherDno_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno
+18218f9f_prefetcherDno_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/no/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno/%.o, $(wildcard /root/repo/ChampSim/prefetcher/no/*.cc))
+$(18218f9f_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/no
+$(18218f9f_prefetcherDno_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno/%.o: /root/repo/ChampSim/prefetcher/no/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno/*.d)
+
+$(18218f9f_prefetcherDno_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_prefetcherDno_objs_0): CPPFLAGS += -include prefetcherDno.inc
+module_dirs += $(18218f9f_prefetcherDno_dirs_0)
+module_objs += $(18218f9f_prefetcherDno_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_prefetcherDno_objs_0)
+###
+# Build ID: 18218f9f_prefetcherDno_instr
+# Source: /root/repo/ChampSim/prefetcher/no_instr
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno_instr
+###
+
+18218f9f_prefetcherDno_instr_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno_instr
+18218f9f_prefetcherDno_instr_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/no_instr/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno_instr/%.o, $(wildcard /root/repo/ChampSim/prefetcher/no_instr/*.cc))
+$(18218f9f_prefetcherDno_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/no_instr
+$(18218f9f_prefetcherDno_instr_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno_instr/%.o: /root/repo/ChampSim/prefetcher/no_instr/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno_instr
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDno_instr/*.d)
+
+$(18218f9f_prefetcherDno_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_prefetcherDno_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_prefetcherDno_instr_objs_0): CPPFLAGS += -include prefetcherDno_instr.inc
+module_dirs += $(18218f9f_prefetcherDno_instr_dirs_0)
+module_objs += $(18218f9f_prefetcherDno_instr_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_prefetcherDno_instr_objs_0)
+###
+# Build ID: 18218f9f_prefetcherDspp_dev
+# Source: /root/repo/ChampSim/prefetcher/spp_dev
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDspp_dev
+###
+
+18218f9f_prefetcherDspp_dev_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDspp_dev
+18218f9f_prefetcherDspp_dev_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/spp_dev/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDspp_dev/%.o, $(wildcard /root/repo/ChampSim/prefetcher/spp_dev/*.cc))
+$(18218f9f_prefetcherDspp_dev_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/spp_dev
+$(18218f9f_prefetcherDspp_dev_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDspp_dev/%.o: /root/repo/ChampSim/prefetcher/spp_dev/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDspp_dev
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDspp_dev/*.d)
+
+$(18218f9f_prefetcherDspp_dev_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_prefetcherDspp_dev_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_prefetcherDspp_dev_objs_0): CPPFLAGS += -include prefetcherDspp_dev.inc
+module_dirs += $(18218f9f_prefetcherDspp_dev_dirs_0)
+module_objs += $(18218f9f_prefetcherDspp_dev_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_prefetcherDspp_dev_objs_0)
+###
+# Build ID: 18218f9f_prefetcherDva_ampm_lite
+# Source: /root/repo/ChampSim/prefetcher/va_ampm_lite
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDva_ampm_lite
+###
+
+18218f9f_prefetcherDva_ampm_lite_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDva_ampm_lite
+18218f9f_prefetcherDva_ampm_lite_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/va_ampm_lite/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDva_ampm_lite/%.o, $(wildcard /root/repo/ChampSim/prefetcher/va_ampm_lite/*.cc))
+$(18218f9f_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/va_ampm_lite
+$(18218f9f_prefetcherDva_ampm_lite_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDva_ampm_lite/%.o: /root/repo/ChampSim/prefetcher/va_ampm_lite/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDva_ampm_lite
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/prefetcherDva_ampm_lite/*.d)
+
+$(18218f9f_prefetcherDva_ampm_lite_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -include prefetcherDva_ampm_lite.inc
+module_dirs += $(18218f9f_prefetcherDva_ampm_lite_dirs_0)
+module_objs += $(18218f9f_prefetcherDva_ampm_lite_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_prefetcherDva_ampm_lite_objs_0)
+###
+# Build ID: 18218f9f_replacementDchirp
+# Source: /root/repo/ChampSim/replacement/chirp
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDchirp
+###
+
+18218f9f_replacementDchirp_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDchirp
+18218f9f_replacementDchirp_objs_0 = $(patsubst /root/repo/ChampSim/replacement/chirp/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDchirp/%.o, $(wildcard /root/repo/ChampSim/replacement/chirp/*.cc))
+$(18218f9f_replacementDchirp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/chirp
+$(18218f9f_replacementDchirp_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDchirp/%.o: /root/repo/ChampSim/replacement/chirp/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDchirp
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDchirp/*.d)
+
+$(18218f9f_replacementDchirp_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDchirp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDchirp_objs_0): CPPFLAGS += -include replacementDchirp.inc
+module_dirs += $(18218f9f_replacementDchirp_dirs_0)
+module_objs += $(18218f9f_replacementDchirp_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDchirp_objs_0)
+###
+# Build ID: 18218f9f_replacementDdrrip
+# Source: /root/repo/ChampSim/replacement/drrip
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDdrrip
+###
+
+18218f9f_replacementDdrrip_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDdrrip
+18218f9f_replacementDdrrip_objs_0 = $(patsubst /root/repo/ChampSim/replacement/drrip/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDdrrip/%.o, $(wildcard /root/repo/ChampSim/replacement/drrip/*.cc))
+$(18218f9f_replacementDdrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/drrip
+$(18218f9f_replacementDdrrip_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDdrrip/%.o: /root/repo/ChampSim/replacement/drrip/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDdrrip
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDdrrip/*.d)
+
+$(18218f9f_replacementDdrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDdrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDdrrip_objs_0): CPPFLAGS += -include replacementDdrrip.inc
+module_dirs += $(18218f9f_replacementDdrrip_dirs_0)
+module_objs += $(18218f9f_replacementDdrrip_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDdrrip_objs_0)
+###
+# Build ID: 18218f9f_replacementDitp
+# Source: /root/repo/ChampSim/replacement/itp
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDitp
+###
+
+18218f9f_replacementDitp_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDitp
+18218f9f_replacementDitp_objs_0 = $(patsubst /root/repo/ChampSim/replacement/itp/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDitp/%.o, $(wildcard /root/repo/ChampSim/replacement/itp/*.cc))
+$(18218f9f_replacementDitp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/itp
+$(18218f9f_replacementDitp_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDitp/%.o: /root/repo/ChampSim/replacement/itp/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDitp
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDitp/*.d)
+
+$(18218f9f_replacementDitp_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDitp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDitp_objs_0): CPPFLAGS += -include replacementDitp.inc
+module_dirs += $(18218f9f_replacementDitp_dirs_0)
+module_objs += $(18218f9f_replacementDitp_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDitp_objs_0)
+###
+# Build ID: 18218f9f_replacementDlfu
+# Source: /root/repo/ChampSim/replacement/lfu
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlfu
+###
+
+18218f9f_replacementDlfu_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlfu
+18218f9f_replacementDlfu_objs_0 = $(patsubst /root/repo/ChampSim/replacement/lfu/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlfu/%.o, $(wildcard /root/repo/ChampSim/replacement/lfu/*.cc))
+$(18218f9f_replacementDlfu_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/lfu
+$(18218f9f_replacementDlfu_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlfu/%.o: /root/repo/ChampSim/replacement/lfu/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlfu
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlfu/*.d)
+
+$(18218f9f_replacementDlfu_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDlfu_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDlfu_objs_0): CPPFLAGS += -include replacementDlfu.inc
+module_dirs += $(18218f9f_replacementDlfu_dirs_0)
+module_objs += $(18218f9f_replacementDlfu_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDlfu_objs_0)
+###
+# Build ID: 18218f9f_replacementDlru
+# Source: /root/repo/ChampSim/replacement/lru
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlru
+###
+
+18218f9f_replacementDlru_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlru
+18218f9f_replacementDlru_objs_0 = $(patsubst /root/repo/ChampSim/replacement/lru/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlru/%.o, $(wildcard /root/repo/ChampSim/replacement/lru/*.cc))
+$(18218f9f_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/lru
+$(18218f9f_replacementDlru_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlru/%.o: /root/repo/ChampSim/replacement/lru/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlru
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDlru/*.d)
+
+$(18218f9f_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDlru_objs_0): CPPFLAGS += -include replacementDlru.inc
+module_dirs += $(18218f9f_replacementDlru_dirs_0)
+module_objs += $(18218f9f_replacementDlru_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDlru_objs_0)
+###
+# Build ID: 18218f9f_replacementDmockingjay
+# Source: /root/repo/ChampSim/replacement/mockingjay
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDmockingjay
+###
+
+18218f9f_replacementDmockingjay_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDmockingjay
+18218f9f_replacementDmockingjay_objs_0 = $(patsubst /root/repo/ChampSim/replacement/mockingjay/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDmockingjay/%.o, $(wildcard /root/repo/ChampSim/replacement/mockingjay/*.cc))
+$(18218f9f_replacementDmockingjay_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/mockingjay
+$(18218f9f_replacementDmockingjay_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDmockingjay/%.o: /root/repo/ChampSim/replacement/mockingjay/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDmockingjay
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDmockingjay/*.d)
+
+$(18218f9f_replacementDmockingjay_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDmockingjay_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDmockingjay_objs_0): CPPFLAGS += -include replacementDmockingjay.inc
+module_dirs += $(18218f9f_replacementDmockingjay_dirs_0)
+module_objs += $(18218f9f_replacementDmockingjay_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDmockingjay_objs_0)
+###
+# Build ID: 18218f9f_replacementDprobi
+# Source: /root/repo/ChampSim/replacement/probi
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDprobi
+###
+
+18218f9f_replacementDprobi_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDprobi
+18218f9f_replacementDprobi_objs_0 = $(patsubst /root/repo/ChampSim/replacement/probi/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDprobi/%.o, $(wildcard /root/repo/ChampSim/replacement/probi/*.cc))
+$(18218f9f_replacementDprobi_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/probi
+$(18218f9f_replacementDprobi_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDprobi/%.o: /root/repo/ChampSim/replacement/probi/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDprobi
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDprobi/*.d)
+
+$(18218f9f_replacementDprobi_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDprobi_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDprobi_objs_0): CPPFLAGS += -include replacementDprobi.inc
+module_dirs += $(18218f9f_replacementDprobi_dirs_0)
+module_objs += $(18218f9f_replacementDprobi_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDprobi_objs_0)
+###
+# Build ID: 18218f9f_replacementDptp
+# Source: /root/repo/ChampSim/replacement/ptp
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDptp
+###
+
+18218f9f_replacementDptp_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDptp
+18218f9f_replacementDptp_objs_0 = $(patsubst /root/repo/ChampSim/replacement/ptp/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDptp/%.o, $(wildcard /root/repo/ChampSim/replacement/ptp/*.cc))
+$(18218f9f_replacementDptp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/ptp
+$(18218f9f_replacementDptp_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDptp/%.o: /root/repo/ChampSim/replacement/ptp/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDptp
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDptp/*.d)
+
+$(18218f9f_replacementDptp_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDptp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDptp_objs_0): CPPFLAGS += -include replacementDptp.inc
+module_dirs += $(18218f9f_replacementDptp_dirs_0)
+module_objs += $(18218f9f_replacementDptp_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDptp_objs_0)
+###
+# Build ID: 18218f9f_replacementDship
+# Source: /root/repo/ChampSim/replacement/ship
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDship
+###
+
+18218f9f_replacementDship_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDship
+18218f9f_replacementDship_objs_0 = $(patsubst /root/repo/ChampSim/replacement/ship/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDship/%.o, $(wildcard /root/repo/ChampSim/replacement/ship/*.cc))
+$(18218f9f_replacementDship_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/ship
+$(18218f9f_replacementDship_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDship/%.o: /root/repo/ChampSim/replacement/ship/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDship
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDship/*.d)
+
+$(18218f9f_replacementDship_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDship_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDship_objs_0): CPPFLAGS += -include replacementDship.inc
+module_dirs += $(18218f9f_replacementDship_dirs_0)
+module_objs += $(18218f9f_replacementDship_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDship_objs_0)
+###
+# Build ID: 18218f9f_replacementDsrrip
+# Source: /root/repo/ChampSim/replacement/srrip
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDsrrip
+###
+
+18218f9f_replacementDsrrip_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDsrrip
+18218f9f_replacementDsrrip_objs_0 = $(patsubst /root/repo/ChampSim/replacement/srrip/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDsrrip/%.o, $(wildcard /root/repo/ChampSim/replacement/srrip/*.cc))
+$(18218f9f_replacementDsrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/srrip
+$(18218f9f_replacementDsrrip_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDsrrip/%.o: /root/repo/ChampSim/replacement/srrip/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDsrrip
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDsrrip/*.d)
+
+$(18218f9f_replacementDsrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDsrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDsrrip_objs_0): CPPFLAGS += -include replacementDsrrip.inc
+module_dirs += $(18218f9f_replacementDsrrip_dirs_0)
+module_objs += $(18218f9f_replacementDsrrip_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDsrrip_objs_0)
+###
+# Build ID: 18218f9f_replacementDtdrrip
+# Source: /root/repo/ChampSim/replacement/tdrrip
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtdrrip
+###
+
+18218f9f_replacementDtdrrip_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtdrrip
+18218f9f_replacementDtdrrip_objs_0 = $(patsubst /root/repo/ChampSim/replacement/tdrrip/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtdrrip/%.o, $(wildcard /root/repo/ChampSim/replacement/tdrrip/*.cc))
+$(18218f9f_replacementDtdrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/tdrrip
+$(18218f9f_replacementDtdrrip_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtdrrip/%.o: /root/repo/ChampSim/replacement/tdrrip/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtdrrip
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtdrrip/*.d)
+
+$(18218f9f_replacementDtdrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDtdrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDtdrrip_objs_0): CPPFLAGS += -include replacementDtdrrip.inc
+module_dirs += $(18218f9f_replacementDtdrrip_dirs_0)
+module_objs += $(18218f9f_replacementDtdrrip_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDtdrrip_objs_0)
+###
+# Build ID: 18218f9f_replacementDtship
+# Source: /root/repo/ChampSim/replacement/tship
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtship
+###
+
+18218f9f_replacementDtship_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtship
+18218f9f_replacementDtship_objs_0 = $(patsubst /root/repo/ChampSim/replacement/tship/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtship/%.o, $(wildcard /root/repo/ChampSim/replacement/tship/*.cc))
+$(18218f9f_replacementDtship_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/tship
+$(18218f9f_replacementDtship_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtship/%.o: /root/repo/ChampSim/replacement/tship/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtship
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDtship/*.d)
+
+$(18218f9f_replacementDtship_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDtship_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDtship_objs_0): CPPFLAGS += -include replacementDtship.inc
+module_dirs += $(18218f9f_replacementDtship_dirs_0)
+module_objs += $(18218f9f_replacementDtship_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDtship_objs_0)
+###
+# Build ID: 18218f9f_replacementDxptp
+# Source: /root/repo/ChampSim/replacement/xptp
+# Destination: /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDxptp
+###
+
+18218f9f_replacementDxptp_dirs_0 = /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDxptp
+18218f9f_replacementDxptp_objs_0 = $(patsubst /root/repo/ChampSim/replacement/xptp/%.cc, /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDxptp/%.o, $(wildcard /root/repo/ChampSim/replacement/xptp/*.cc))
+$(18218f9f_replacementDxptp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/xptp
+$(18218f9f_replacementDxptp_objs_0): /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDxptp/%.o: /root/repo/ChampSim/replacement/xptp/%.cc | /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDxptp
+-include $(wildcard /root/repo/ChampSim/.bench/.csconfig/test/18218f9f/replacementDxptp/*.d)
+
+$(18218f9f_replacementDxptp_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(18218f9f_replacementDxptp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.bench/.csconfig/test/18218f9f/inc
+$(18218f9f_replacementDxptp_objs_0): CPPFLAGS += -include replacementDxptp.inc
+module_dirs += $(18218f9f_replacementDxptp_dirs_0)
+module_objs += $(18218f9f_replacementDxptp_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(18218f9f_replacementDxptp_objs_0)
@@ -0,0 +1,622 @@
+###
+# THIS FILE IS AUTOMATICALLY GENERATED
+# Do not edit this file. It will be overwritten when the configure script is run.
+###
+
+######
+# Build ID: 69b87fc2
+# Executable: /root/repo/ChampSim/bin/champsim_wp64
+######
+
+###
+# Build ID: 69b87fc2
+# Source: /root/repo/ChampSim/src
+# Destination: /root/repo/ChampSim/.csconfig/69b87fc2/obj
+###
+
+69b87fc2_dirs_0 = /root/repo/ChampSim/.csconfig/69b87fc2/obj
+69b87fc2_objs_0 = $(patsubst /root/repo/ChampSim/src/%.cc, /root/repo/ChampSim/.csconfig/69b87fc2/obj/%.o, $(wildcard /root/repo/ChampSim/src/*.cc))
+$(69b87fc2_objs_0): CPPFLAGS += -I/root/repo/ChampSim/src
+$(69b87fc2_objs_0): /root/repo/ChampSim/.csconfig/69b87fc2/obj/%.o: /root/repo/ChampSim/src/%.cc | /root/repo/ChampSim/.csconfig/69b87fc2/obj
+-include $(wildcard /root/repo/ChampSim/.csconfig/69b87fc2/obj/*.d)
+
+/root/repo/ChampSim/bin/champsim_wp64: $(69b87fc2_objs_0) | /root/repo/ChampSim/bin
+$(69b87fc2_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/69b87fc2/inc
+build_dirs += $(69b87fc2_dirs_0) /root/repo/ChampSim/bin
+build_objs += $(69b87fc2_objs_0)
+executable_name += /root/repo/ChampSim/bin/champsim_wp64
+
+###
+# Build ID: 69b87fc2_btbDbasic_btb
+# Source: /root/repo/ChampSim/btb/basic_btb
+# Destination: /root/repo/ChampSim/.csconfig/69b87fc2/btbDbasic_btb
+###
+
+69b87fc2_btbDbasic_btb_dirs_0 = /root/repo/ChampSim/.csconfig/69b87fc2/btbDbasic_btb
+69b87fc2_btbDbasic_btb_objs_0 = $(patsubst /root/repo/ChampSim/btb/basic_btb/%.cc, /root/repo/ChampSim/.csconfig/69b87fc2/btbDbasic_btb/%.o, $(wildcard /root/repo/ChampSim/btb/basic_btb/*.cc))
+$(69b87fc2_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/btb/basic_btb
+$(69b87fc2_btbDbasic_btb_objs_0): /root/repo/ChampSim/.csconfig/69b87fc2/btbDbasic_btb/%.o: /root/repo/ChampSim/btb/basic_btb/%.cc | /root/repo/ChampSim/.csconfig/69b87fc2/btbDbasic_btb
+-include $(wildcard /root/repo/ChampSim/.csconfig/69b87fc2/btbDbasic_btb/*.d)
+
+$(69b87fc2_btbDbasic_btb_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(69b87fc2_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/69b87fc2/inc
+$(69b87fc2_btbDbasic_btb_objs_0): CPPFLAGS += -include btbDbasic_btb.inc
+module_dirs += $(69b87fc2_btbDbasic_btb_dirs_0)
+module_objs += $(69b87fc2_btbDbasic_btb_objs_0)
+
+/root/repo/ChampSim/bin/champsim_wp64: $(69b87fc2_btbDbasic_btb_objs_0)
+###
+# Build ID: 69b87fc2_branchDbimodal
+# Source: /root/repo/ChampSim/branch/bimodal
+# Destination: /root/repo/ChampSim/.csconfig/69b87fc2/branchDbimodal
+###
+
+69b87fc2_branchDbimodal_dirs_0 = /root/repo/ChampSim/.csconfig/69b87fc2/branchDbimodal
+69b87fc2_branchDbimodal_objs_0 = $(patsubst /root/repo/ChampSim/branch/bimodal/%.cc, /root/repo/ChampSim/.csconfig/69b87fc2/branchDbimodal/%.o, $(wildcard /root/repo/ChampSim/branch/bimodal/*.cc))
+$(69b87fc2_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/bimodal
+$(69b87fc2_branchDbimodal_objs_0): /root/repo/ChampSim/.csconfig/69b87fc2/branchDbimodal/%.o: /root/repo/ChampSim/branch/bimodal/%.cc | /root/repo/ChampSim/.csconfig/69b87fc2/branchDbimodal
+-include $(wildcard /root/repo/ChampSim/.csconfig/69b87fc2/branchDbimodal/*.d)
+
+$(69b87fc2_branchDbimodal_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(69b87fc2_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/69b87fc2/inc
+$(69b87fc2_branchDbimodal_objs_0): CPPFLAGS += -include branchDbimodal.inc
+module_dirs += $(69b87fc2_branchDbimodal_dirs_0)
+module_objs += $(69b87fc2_branchDbimodal_objs_0)
+
+/root/repo/ChampSim/bin/champsim_wp64: $(69b87fc2_branchDbimodal_objs_0)
+###
+# Build ID: 69b87fc2_prefetcherDno
+# Source: /root/repo/ChampSim/prefetcher/no
+# Destination: /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno
+###
+
+69b87fc2_prefetcherDno_dirs_0 = /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno
+69b87fc2_prefetcherDno_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/no/%.cc, /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno/%.o, $(wildcard /root/repo/ChampSim/prefetcher/no/*.cc))
+$(69b87fc2_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/no
+$(69b87fc2_prefetcherDno_objs_0): /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno/%.o: /root/repo/ChampSim/prefetcher/no/%.cc | /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno
+-include $(wildcard /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno/*.d)
+
+$(69b87fc2_prefetcherDno_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(69b87fc2_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/69b87fc2/inc
+$(69b87fc2_prefetcherDno_objs_0): CPPFLAGS += -include prefetcherDno.inc
+module_dirs += $(69b87fc2_prefetcherDno_dirs_0)
+module_objs += $(69b87fc2_prefetcherDno_objs_0)
+
+/root/repo/ChampSim/bin/champsim_wp64: $(69b87fc2_prefetcherDno_objs_0)
+###
+# Build ID: 69b87fc2_prefetcherDno_instr
+# Source: /root/repo/ChampSim/prefetcher/no_instr
+# Destination: /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno_instr
+###
+
+69b87fc2_prefetcherDno_instr_dirs_0 = /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno_instr
+69b87fc2_prefetcherDno_instr_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/no_instr/%.cc, /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno_instr/%.o, $(wildcard /root/repo/ChampSim/prefetcher/no_instr/*.cc))
+$(69b87fc2_prefetcherDno_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/no_instr
+$(69b87fc2_prefetcherDno_instr_objs_0): /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno_instr/%.o: /root/repo/ChampSim/prefetcher/no_instr/%.cc | /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno_instr
+-include $(wildcard /root/repo/ChampSim/.csconfig/69b87fc2/prefetcherDno_instr/*.d)
+
+$(69b87fc2_prefetcherDno_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(69b87fc2_prefetcherDno_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/69b87fc2/inc
+$(69b87fc2_prefetcherDno_instr_objs_0): CPPFLAGS += -include prefetcherDno_instr.inc
+module_dirs += $(69b87fc2_prefetcherDno_instr_dirs_0)
+module_objs += $(69b87fc2_prefetcherDno_instr_objs_0)
+
+/root/repo/ChampSim/bin/champsim_wp64: $(69b87fc2_prefetcherDno_instr_objs_0)
+###
+# Build ID: 69b87fc2_replacementDlru
+# Source: /root/repo/ChampSim/replacement/lru
+# Destination: /root/repo/ChampSim/.csconfig/69b87fc2/replacementDlru
+###
+
+69b87fc2_replacementDlru_dirs_0 = /root/repo/ChampSim/.csconfig/69b87fc2/replacementDlru
+69b87fc2_replacementDlru_objs_0 = $(patsubst /root/repo/ChampSim/replacement/lru/%.cc, /root/repo/ChampSim/.csconfig/69b87fc2/replacementDlru/%.o, $(wildcard /root/repo/ChampSim/replacement/lru/*.cc))
+$(69b87fc2_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/lru
+$(69b87fc2_replacementDlru_objs_0): /root/repo/ChampSim/.csconfig/69b87fc2/replacementDlru/%.o: /root/repo/ChampSim/replacement/lru/%.cc | /root/repo/ChampSim/.csconfig/69b87fc2/replacementDlru
+-include $(wildcard /root/repo/ChampSim/.csconfig/69b87fc2/replacementDlru/*.d)
+
+$(69b87fc2_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(69b87fc2_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/69b87fc2/inc
+$(69b87fc2_replacementDlru_objs_0): CPPFLAGS += -include replacementDlru.inc
+module_dirs += $(69b87fc2_replacementDlru_dirs_0)
+module_objs += $(69b87fc2_replacementDlru_objs_0)
+
+/root/repo/ChampSim/bin/champsim_wp64: $(69b87fc2_replacementDlru_objs_0)
+
+######
+# Build ID: a1f38e47
+# Executable: /root/repo/ChampSim/test/bin/000-test-main
+######
+
+###
+# Build ID: a1f38e47
+# Source: /root/repo/ChampSim/src
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/obj
+###
+
+a1f38e47_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/obj
+a1f38e47_objs_0 = $(patsubst /root/repo/ChampSim/src/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/obj/%.o, $(wildcard /root/repo/ChampSim/src/*.cc))
+$(a1f38e47_objs_0): CPPFLAGS += -I/root/repo/ChampSim/src
+$(a1f38e47_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/obj/%.o: /root/repo/ChampSim/src/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/obj
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/obj/*.d)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_objs_0) | /root/repo/ChampSim/test/bin
+$(a1f38e47_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+build_dirs += $(a1f38e47_dirs_0) /root/repo/ChampSim/test/bin
+build_objs += $(a1f38e47_objs_0)
+executable_name += /root/repo/ChampSim/test/bin/000-test-main
+
+###
+# Build ID: a1f38e47_btbDbasic_btb
+# Source: /root/repo/ChampSim/btb/basic_btb
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/btbDbasic_btb
+###
+
+a1f38e47_btbDbasic_btb_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/btbDbasic_btb
+a1f38e47_btbDbasic_btb_objs_0 = $(patsubst /root/repo/ChampSim/btb/basic_btb/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/btbDbasic_btb/%.o, $(wildcard /root/repo/ChampSim/btb/basic_btb/*.cc))
+$(a1f38e47_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/btb/basic_btb
+$(a1f38e47_btbDbasic_btb_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/btbDbasic_btb/%.o: /root/repo/ChampSim/btb/basic_btb/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/btbDbasic_btb
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/btbDbasic_btb/*.d)
+
+$(a1f38e47_btbDbasic_btb_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_btbDbasic_btb_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_btbDbasic_btb_objs_0): CPPFLAGS += -include btbDbasic_btb.inc
+module_dirs += $(a1f38e47_btbDbasic_btb_dirs_0)
+module_objs += $(a1f38e47_btbDbasic_btb_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_btbDbasic_btb_objs_0)
+###
+# Build ID: a1f38e47_branchDbimodal
+# Source: /root/repo/ChampSim/branch/bimodal
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDbimodal
+###
+
+a1f38e47_branchDbimodal_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDbimodal
+a1f38e47_branchDbimodal_objs_0 = $(patsubst /root/repo/ChampSim/branch/bimodal/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDbimodal/%.o, $(wildcard /root/repo/ChampSim/branch/bimodal/*.cc))
+$(a1f38e47_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/bimodal
+$(a1f38e47_branchDbimodal_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDbimodal/%.o: /root/repo/ChampSim/branch/bimodal/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDbimodal
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDbimodal/*.d)
+
+$(a1f38e47_branchDbimodal_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_branchDbimodal_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_branchDbimodal_objs_0): CPPFLAGS += -include branchDbimodal.inc
+module_dirs += $(a1f38e47_branchDbimodal_dirs_0)
+module_objs += $(a1f38e47_branchDbimodal_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_branchDbimodal_objs_0)
+###
+# Build ID: a1f38e47_branchDgshare
+# Source: /root/repo/ChampSim/branch/gshare
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDgshare
+###
+
+a1f38e47_branchDgshare_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDgshare
+a1f38e47_branchDgshare_objs_0 = $(patsubst /root/repo/ChampSim/branch/gshare/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDgshare/%.o, $(wildcard /root/repo/ChampSim/branch/gshare/*.cc))
+$(a1f38e47_branchDgshare_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/gshare
+$(a1f38e47_branchDgshare_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDgshare/%.o: /root/repo/ChampSim/branch/gshare/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDgshare
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDgshare/*.d)
+
+$(a1f38e47_branchDgshare_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_branchDgshare_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_branchDgshare_objs_0): CPPFLAGS += -include branchDgshare.inc
+module_dirs += $(a1f38e47_branchDgshare_dirs_0)
+module_objs += $(a1f38e47_branchDgshare_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_branchDgshare_objs_0)
+###
+# Build ID: a1f38e47_branchDhashed_perceptron
+# Source: /root/repo/ChampSim/branch/hashed_perceptron
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDhashed_perceptron
+###
+
+a1f38e47_branchDhashed_perceptron_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDhashed_perceptron
+a1f38e47_branchDhashed_perceptron_objs_0 = $(patsubst /root/repo/ChampSim/branch/hashed_perceptron/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDhashed_perceptron/%.o, $(wildcard /root/repo/ChampSim/branch/hashed_perceptron/*.cc))
+$(a1f38e47_branchDhashed_perceptron_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/hashed_perceptron
+$(a1f38e47_branchDhashed_perceptron_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDhashed_perceptron/%.o: /root/repo/ChampSim/branch/hashed_perceptron/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDhashed_perceptron
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDhashed_perceptron/*.d)
+
+$(a1f38e47_branchDhashed_perceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_branchDhashed_perceptron_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_branchDhashed_perceptron_objs_0): CPPFLAGS += -include branchDhashed_perceptron.inc
+module_dirs += $(a1f38e47_branchDhashed_perceptron_dirs_0)
+module_objs += $(a1f38e47_branchDhashed_perceptron_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_branchDhashed_perceptron_objs_0)
+###
+# Build ID: a1f38e47_branchDperceptron
+# Source: /root/repo/ChampSim/branch/perceptron
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDperceptron
+###
+
+a1f38e47_branchDperceptron_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDperceptron
+a1f38e47_branchDperceptron_objs_0 = $(patsubst /root/repo/ChampSim/branch/perceptron/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDperceptron/%.o, $(wildcard /root/repo/ChampSim/branch/perceptron/*.cc))
+$(a1f38e47_branchDperceptron_objs_0): CPPFLAGS += -I/root/repo/ChampSim/branch/perceptron
+$(a1f38e47_branchDperceptron_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDperceptron/%.o: /root/repo/ChampSim/branch/perceptron/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDperceptron
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/branchDperceptron/*.d)
+
+$(a1f38e47_branchDperceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_branchDperceptron_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_branchDperceptron_objs_0): CPPFLAGS += -include branchDperceptron.inc
+module_dirs += $(a1f38e47_branchDperceptron_dirs_0)
+module_objs += $(a1f38e47_branchDperceptron_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_branchDperceptron_objs_0)
+###
+# Build ID: a1f38e47_prefetcherDip_stride
+# Source: /root/repo/ChampSim/prefetcher/ip_stride
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDip_stride
+###
+
+a1f38e47_prefetcherDip_stride_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDip_stride
+a1f38e47_prefetcherDip_stride_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/ip_stride/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDip_stride/%.o, $(wildcard /root/repo/ChampSim/prefetcher/ip_stride/*.cc))
+$(a1f38e47_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/ip_stride
+$(a1f38e47_prefetcherDip_stride_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDip_stride/%.o: /root/repo/ChampSim/prefetcher/ip_stride/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDip_stride
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDip_stride/*.d)
+
+$(a1f38e47_prefetcherDip_stride_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_prefetcherDip_stride_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_prefetcherDip_stride_objs_0): CPPFLAGS += -include prefetcherDip_stride.inc
+module_dirs += $(a1f38e47_prefetcherDip_stride_dirs_0)
+module_objs += $(a1f38e47_prefetcherDip_stride_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_prefetcherDip_stride_objs_0)
+###
+# Build ID: a1f38e47_prefetcherDnext_line
+# Source: /root/repo/ChampSim/prefetcher/next_line
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line
+###
+
+a1f38e47_prefetcherDnext_line_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line
+a1f38e47_prefetcherDnext_line_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line/*.cc))
+$(a1f38e47_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line
+$(a1f38e47_prefetcherDnext_line_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line/%.o: /root/repo/ChampSim/prefetcher/next_line/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line/*.d)
+
+$(a1f38e47_prefetcherDnext_line_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_prefetcherDnext_line_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_prefetcherDnext_line_objs_0): CPPFLAGS += -include prefetcherDnext_line.inc
+module_dirs += $(a1f38e47_prefetcherDnext_line_dirs_0)
+module_objs += $(a1f38e47_prefetcherDnext_line_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_prefetcherDnext_line_objs_0)
+###
+# Build ID: a1f38e47_prefetcherDnext_line_instr
+# Source: /root/repo/ChampSim/prefetcher/next_line_instr
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line_instr
+###
+
+a1f38e47_prefetcherDnext_line_instr_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line_instr
+a1f38e47_prefetcherDnext_line_instr_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/next_line_instr/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line_instr/%.o, $(wildcard /root/repo/ChampSim/prefetcher/next_line_instr/*.cc))
+$(a1f38e47_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/next_line_instr
+$(a1f38e47_prefetcherDnext_line_instr_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line_instr/%.o: /root/repo/ChampSim/prefetcher/next_line_instr/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line_instr
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDnext_line_instr/*.d)
+
+$(a1f38e47_prefetcherDnext_line_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -include prefetcherDnext_line_instr.inc
+module_dirs += $(a1f38e47_prefetcherDnext_line_instr_dirs_0)
+module_objs += $(a1f38e47_prefetcherDnext_line_instr_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_prefetcherDnext_line_instr_objs_0)
+###
+# Build ID: a1f38e47_prefetcherDno
+# Source: /root/repo/ChampSim/prefetcher/no
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno
+###
+
+a1f38e47_prefetcherDno_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno
+a1f38e47_prefetcherDno_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/no/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno/%.o, $(wildcard /root/repo/ChampSim/prefetcher/no/*.cc))
+$(a1f38e47_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/no
+$(a1f38e47_prefetcherDno_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno/%.o: /root/repo/ChampSim/prefetcher/no/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno/*.d)
+
+$(a1f38e47_prefetcherDno_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_prefetcherDno_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_prefetcherDno_objs_0): CPPFLAGS += -include prefetcherDno.inc
+module_dirs += $(a1f38e47_prefetcherDno_dirs_0)
+module_objs += $(a1f38e47_prefetcherDno_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_prefetcherDno_objs_0)
+###
+# Build ID: a1f38e47_prefetcherDno_instr
+# Source: /root/repo/ChampSim/prefetcher/no_instr
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno_instr
+###
+
+a1f38e47_prefetcherDno_instr_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno_instr
+a1f38e47_prefetcherDno_instr_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/no_instr/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno_instr/%.o, $(wildcard /root/repo/ChampSim/prefetcher/no_instr/*.cc))
+$(a1f38e47_prefetcherDno_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/no_instr
+$(a1f38e47_prefetcherDno_instr_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno_instr/%.o: /root/repo/ChampSim/prefetcher/no_instr/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno_instr
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDno_instr/*.d)
+
+$(a1f38e47_prefetcherDno_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_prefetcherDno_instr_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_prefetcherDno_instr_objs_0): CPPFLAGS += -include prefetcherDno_instr.inc
+module_dirs += $(a1f38e47_prefetcherDno_instr_dirs_0)
+module_objs += $(a1f38e47_prefetcherDno_instr_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_prefetcherDno_instr_objs_0)
+###
+# Build ID: a1f38e47_prefetcherDspp_dev
+# Source: /root/repo/ChampSim/prefetcher/spp_dev
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDspp_dev
+###
+
+a1f38e47_prefetcherDspp_dev_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDspp_dev
+a1f38e47_prefetcherDspp_dev_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/spp_dev/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDspp_dev/%.o, $(wildcard /root/repo/ChampSim/prefetcher/spp_dev/*.cc))
+$(a1f38e47_prefetcherDspp_dev_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/spp_dev
+$(a1f38e47_prefetcherDspp_dev_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDspp_dev/%.o: /root/repo/ChampSim/prefetcher/spp_dev/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDspp_dev
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDspp_dev/*.d)
+
+$(a1f38e47_prefetcherDspp_dev_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_prefetcherDspp_dev_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_prefetcherDspp_dev_objs_0): CPPFLAGS += -include prefetcherDspp_dev.inc
+module_dirs += $(a1f38e47_prefetcherDspp_dev_dirs_0)
+module_objs += $(a1f38e47_prefetcherDspp_dev_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_prefetcherDspp_dev_objs_0)
+###
+# Build ID: a1f38e47_prefetcherDva_ampm_lite
+# Source: /root/repo/ChampSim/prefetcher/va_ampm_lite
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDva_ampm_lite
+###
+
+a1f38e47_prefetcherDva_ampm_lite_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDva_ampm_lite
+a1f38e47_prefetcherDva_ampm_lite_objs_0 = $(patsubst /root/repo/ChampSim/prefetcher/va_ampm_lite/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDva_ampm_lite/%.o, $(wildcard /root/repo/ChampSim/prefetcher/va_ampm_lite/*.cc))
+$(a1f38e47_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -I/root/repo/ChampSim/prefetcher/va_ampm_lite
+$(a1f38e47_prefetcherDva_ampm_lite_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDva_ampm_lite/%.o: /root/repo/ChampSim/prefetcher/va_ampm_lite/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDva_ampm_lite
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/prefetcherDva_ampm_lite/*.d)
+
+$(a1f38e47_prefetcherDva_ampm_lite_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -include prefetcherDva_ampm_lite.inc
+module_dirs += $(a1f38e47_prefetcherDva_ampm_lite_dirs_0)
+module_objs += $(a1f38e47_prefetcherDva_ampm_lite_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_prefetcherDva_ampm_lite_objs_0)
+###
+# Build ID: a1f38e47_replacementDchirp
+# Source: /root/repo/ChampSim/replacement/chirp
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDchirp
+###
+
+a1f38e47_replacementDchirp_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDchirp
+a1f38e47_replacementDchirp_objs_0 = $(patsubst /root/repo/ChampSim/replacement/chirp/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDchirp/%.o, $(wildcard /root/repo/ChampSim/replacement/chirp/*.cc))
+$(a1f38e47_replacementDchirp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/chirp
+$(a1f38e47_replacementDchirp_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDchirp/%.o: /root/repo/ChampSim/replacement/chirp/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDchirp
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDchirp/*.d)
+
+$(a1f38e47_replacementDchirp_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDchirp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDchirp_objs_0): CPPFLAGS += -include replacementDchirp.inc
+module_dirs += $(a1f38e47_replacementDchirp_dirs_0)
+module_objs += $(a1f38e47_replacementDchirp_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDchirp_objs_0)
+###
+# Build ID: a1f38e47_replacementDdrrip
+# Source: /root/repo/ChampSim/replacement/drrip
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDdrrip
+###
+
+a1f38e47_replacementDdrrip_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDdrrip
+a1f38e47_replacementDdrrip_objs_0 = $(patsubst /root/repo/ChampSim/replacement/drrip/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDdrrip/%.o, $(wildcard /root/repo/ChampSim/replacement/drrip/*.cc))
+$(a1f38e47_replacementDdrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/drrip
+$(a1f38e47_replacementDdrrip_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDdrrip/%.o: /root/repo/ChampSim/replacement/drrip/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDdrrip
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDdrrip/*.d)
+
+$(a1f38e47_replacementDdrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDdrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDdrrip_objs_0): CPPFLAGS += -include replacementDdrrip.inc
+module_dirs += $(a1f38e47_replacementDdrrip_dirs_0)
+module_objs += $(a1f38e47_replacementDdrrip_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDdrrip_objs_0)
+###
+# Build ID: a1f38e47_replacementDitp
+# Source: /root/repo/ChampSim/replacement/itp
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDitp
+###
+
+a1f38e47_replacementDitp_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDitp
+a1f38e47_replacementDitp_objs_0 = $(patsubst /root/repo/ChampSim/replacement/itp/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDitp/%.o, $(wildcard /root/repo/ChampSim/replacement/itp/*.cc))
+$(a1f38e47_replacementDitp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/itp
+$(a1f38e47_replacementDitp_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDitp/%.o: /root/repo/ChampSim/replacement/itp/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDitp
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDitp/*.d)
+
+$(a1f38e47_replacementDitp_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDitp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDitp_objs_0): CPPFLAGS += -include replacementDitp.inc
+module_dirs += $(a1f38e47_replacementDitp_dirs_0)
+module_objs += $(a1f38e47_replacementDitp_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDitp_objs_0)
+###
+# Build ID: a1f38e47_replacementDlfu
+# Source: /root/repo/ChampSim/replacement/lfu
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlfu
+###
+
+a1f38e47_replacementDlfu_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlfu
+a1f38e47_replacementDlfu_objs_0 = $(patsubst /root/repo/ChampSim/replacement/lfu/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlfu/%.o, $(wildcard /root/repo/ChampSim/replacement/lfu/*.cc))
+$(a1f38e47_replacementDlfu_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/lfu
+$(a1f38e47_replacementDlfu_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlfu/%.o: /root/repo/ChampSim/replacement/lfu/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlfu
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlfu/*.d)
+
+$(a1f38e47_replacementDlfu_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDlfu_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDlfu_objs_0): CPPFLAGS += -include replacementDlfu.inc
+module_dirs += $(a1f38e47_replacementDlfu_dirs_0)
+module_objs += $(a1f38e47_replacementDlfu_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDlfu_objs_0)
+###
+# Build ID: a1f38e47_replacementDlru
+# Source: /root/repo/ChampSim/replacement/lru
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlru
+###
+
+a1f38e47_replacementDlru_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlru
+a1f38e47_replacementDlru_objs_0 = $(patsubst /root/repo/ChampSim/replacement/lru/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlru/%.o, $(wildcard /root/repo/ChampSim/replacement/lru/*.cc))
+$(a1f38e47_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/lru
+$(a1f38e47_replacementDlru_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlru/%.o: /root/repo/ChampSim/replacement/lru/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlru
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDlru/*.d)
+
+$(a1f38e47_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDlru_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDlru_objs_0): CPPFLAGS += -include replacementDlru.inc
+module_dirs += $(a1f38e47_replacementDlru_dirs_0)
+module_objs += $(a1f38e47_replacementDlru_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDlru_objs_0)
+###
+# Build ID: a1f38e47_replacementDmockingjay
+# Source: /root/repo/ChampSim/replacement/mockingjay
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDmockingjay
+###
+
+a1f38e47_replacementDmockingjay_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDmockingjay
+a1f38e47_replacementDmockingjay_objs_0 = $(patsubst /root/repo/ChampSim/replacement/mockingjay/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDmockingjay/%.o, $(wildcard /root/repo/ChampSim/replacement/mockingjay/*.cc))
+$(a1f38e47_replacementDmockingjay_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/mockingjay
+$(a1f38e47_replacementDmockingjay_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDmockingjay/%.o: /root/repo/ChampSim/replacement/mockingjay/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDmockingjay
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDmockingjay/*.d)
+
+$(a1f38e47_replacementDmockingjay_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDmockingjay_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDmockingjay_objs_0): CPPFLAGS += -include replacementDmockingjay.inc
+module_dirs += $(a1f38e47_replacementDmockingjay_dirs_0)
+module_objs += $(a1f38e47_replacementDmockingjay_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDmockingjay_objs_0)
+###
+# Build ID: a1f38e47_replacementDprobi
+# Source: /root/repo/ChampSim/replacement/probi
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDprobi
+###
+
+a1f38e47_replacementDprobi_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDprobi
+a1f38e47_replacementDprobi_objs_0 = $(patsubst /root/repo/ChampSim/replacement/probi/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDprobi/%.o, $(wildcard /root/repo/ChampSim/replacement/probi/*.cc))
+$(a1f38e47_replacementDprobi_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/probi
+$(a1f38e47_replacementDprobi_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDprobi/%.o: /root/repo/ChampSim/replacement/probi/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDprobi
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDprobi/*.d)
+
+$(a1f38e47_replacementDprobi_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDprobi_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDprobi_objs_0): CPPFLAGS += -include replacementDprobi.inc
+module_dirs += $(a1f38e47_replacementDprobi_dirs_0)
+module_objs += $(a1f38e47_replacementDprobi_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDprobi_objs_0)
+###
+# Build ID: a1f38e47_replacementDptp
+# Source: /root/repo/ChampSim/replacement/ptp
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDptp
+###
+
+a1f38e47_replacementDptp_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDptp
+a1f38e47_replacementDptp_objs_0 = $(patsubst /root/repo/ChampSim/replacement/ptp/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDptp/%.o, $(wildcard /root/repo/ChampSim/replacement/ptp/*.cc))
+$(a1f38e47_replacementDptp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/ptp
+$(a1f38e47_replacementDptp_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDptp/%.o: /root/repo/ChampSim/replacement/ptp/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDptp
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDptp/*.d)
+
+$(a1f38e47_replacementDptp_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDptp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDptp_objs_0): CPPFLAGS += -include replacementDptp.inc
+module_dirs += $(a1f38e47_replacementDptp_dirs_0)
+module_objs += $(a1f38e47_replacementDptp_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDptp_objs_0)
+###
+# Build ID: a1f38e47_replacementDship
+# Source: /root/repo/ChampSim/replacement/ship
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDship
+###
+
+a1f38e47_replacementDship_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDship
+a1f38e47_replacementDship_objs_0 = $(patsubst /root/repo/ChampSim/replacement/ship/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDship/%.o, $(wildcard /root/repo/ChampSim/replacement/ship/*.cc))
+$(a1f38e47_replacementDship_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/ship
+$(a1f38e47_replacementDship_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDship/%.o: /root/repo/ChampSim/replacement/ship/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDship
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDship/*.d)
+
+$(a1f38e47_replacementDship_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDship_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDship_objs_0): CPPFLAGS += -include replacementDship.inc
+module_dirs += $(a1f38e47_replacementDship_dirs_0)
+module_objs += $(a1f38e47_replacementDship_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDship_objs_0)
+###
+# Build ID: a1f38e47_replacementDsrrip
+# Source: /root/repo/ChampSim/replacement/srrip
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDsrrip
+###
+
+a1f38e47_replacementDsrrip_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDsrrip
+a1f38e47_replacementDsrrip_objs_0 = $(patsubst /root/repo/ChampSim/replacement/srrip/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDsrrip/%.o, $(wildcard /root/repo/ChampSim/replacement/srrip/*.cc))
+$(a1f38e47_replacementDsrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/srrip
+$(a1f38e47_replacementDsrrip_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDsrrip/%.o: /root/repo/ChampSim/replacement/srrip/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDsrrip
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDsrrip/*.d)
+
+$(a1f38e47_replacementDsrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDsrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDsrrip_objs_0): CPPFLAGS += -include replacementDsrrip.inc
+module_dirs += $(a1f38e47_replacementDsrrip_dirs_0)
+module_objs += $(a1f38e47_replacementDsrrip_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDsrrip_objs_0)
+###
+# Build ID: a1f38e47_replacementDtdrrip
+# Source: /root/repo/ChampSim/replacement/tdrrip
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtdrrip
+###
+
+a1f38e47_replacementDtdrrip_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtdrrip
+a1f38e47_replacementDtdrrip_objs_0 = $(patsubst /root/repo/ChampSim/replacement/tdrrip/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtdrrip/%.o, $(wildcard /root/repo/ChampSim/replacement/tdrrip/*.cc))
+$(a1f38e47_replacementDtdrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/tdrrip
+$(a1f38e47_replacementDtdrrip_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtdrrip/%.o: /root/repo/ChampSim/replacement/tdrrip/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtdrrip
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtdrrip/*.d)
+
+$(a1f38e47_replacementDtdrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDtdrrip_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDtdrrip_objs_0): CPPFLAGS += -include replacementDtdrrip.inc
+module_dirs += $(a1f38e47_replacementDtdrrip_dirs_0)
+module_objs += $(a1f38e47_replacementDtdrrip_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDtdrrip_objs_0)
+###
+# Build ID: a1f38e47_replacementDtship
+# Source: /root/repo/ChampSim/replacement/tship
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtship
+###
+
+a1f38e47_replacementDtship_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtship
+a1f38e47_replacementDtship_objs_0 = $(patsubst /root/repo/ChampSim/replacement/tship/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtship/%.o, $(wildcard /root/repo/ChampSim/replacement/tship/*.cc))
+$(a1f38e47_replacementDtship_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/tship
+$(a1f38e47_replacementDtship_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtship/%.o: /root/repo/ChampSim/replacement/tship/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtship
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDtship/*.d)
+
+$(a1f38e47_replacementDtship_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDtship_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDtship_objs_0): CPPFLAGS += -include replacementDtship.inc
+module_dirs += $(a1f38e47_replacementDtship_dirs_0)
+module_objs += $(a1f38e47_replacementDtship_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDtship_objs_0)
+###
+# Build ID: a1f38e47_replacementDxptp
+# Source: /root/repo/ChampSim/replacement/xptp
+# Destination: /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDxptp
+###
+
+a1f38e47_replacementDxptp_dirs_0 = /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDxptp
+a1f38e47_replacementDxptp_objs_0 = $(patsubst /root/repo/ChampSim/replacement/xptp/%.cc, /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDxptp/%.o, $(wildcard /root/repo/ChampSim/replacement/xptp/*.cc))
+$(a1f38e47_replacementDxptp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/replacement/xptp
+$(a1f38e47_replacementDxptp_objs_0): /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDxptp/%.o: /root/repo/ChampSim/replacement/xptp/%.cc | /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDxptp
+-include $(wildcard /root/repo/ChampSim/.csconfig/test/a1f38e47/replacementDxptp/*.d)
+
+$(a1f38e47_replacementDxptp_objs_0): CXXFLAGS += -Wno-unused-parameter
+$(a1f38e47_replacementDxptp_objs_0): CPPFLAGS += -I/root/repo/ChampSim/.csconfig/test/a1f38e47/inc
+$(a1f38e47_replacementDxptp_objs_0): CPPFLAGS += -include replacementDxptp.inc
+module_dirs += $(a1f38e47_replacementDxptp_dirs_0)
+module_objs += $(a1f38e47_replacementDxptp_objs_0)
+
+/root/repo/ChampSim/test/bin/000-test-main: $(a1f38e47_replacementDxptp_objs_0)
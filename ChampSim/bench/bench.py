@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+#
+#    Copyright 2023 The ChampSim Contributors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Measures the throughput of the simulator: simulated instructions per second of host time, and the peak memory of the process.
+# Synthetic traces stand in for the workloads, so that the suite needs nothing but this repository, and each is run under a few
+# representative configurations. Results can be saved and compared against those of an earlier version of the simulator.
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import time
+
+import gen_trace
+
+champsim_root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Overrides of the base configuration, by name
+CONFIGURATIONS = {
+    'baseline': {},
+    'itp': {'STLB': {'replacement': 'itp'}},
+    'xptp': {'STLB': {'replacement': 'itp'}, 'L2C': {'replacement': 'xptp'}},
+    'multicore': {'num_cores': 2},
+}
+
+# The synthetic workload run on each core, and the percentage of instruction and data pages that are large
+SCENARIOS = {
+    'core': ('core', 0, 0),
+    'frontend': ('frontend', 0, 0),
+    'stlb': ('stlb', 0, 0),
+    'stlb-2m': ('stlb', 0, 50),
+}
+
+# The defaults of the iTP and xPTP policies, as in the experiments
+POLICY_ENVIRONMENT = {
+    'ITP_INSTR_POS': '0', 'ITP_DATA_POS': '2', 'ITP_MAX_LRU': '8',
+    'MIN_EVICTION_POSITION': '4', 'MIN_EVICTION_POSITION_L1D': '8', 'MIN_EVICTION_POSITION_L2C': '4',
+    'TLB_LOWER_STRESS_THRESHOLD': '1', 'TLB_UPPER_STRESS_THRESHOLD': '4',
+}
+
+def executable_name(config):
+    return 'bench_' + config
+
+def build(args):
+    overrides = [{'executable_name': executable_name(name), **CONFIGURATIONS[name]} for name in args.configs]
+    overrides_name = os.path.join(args.workdir, 'configurations.json')
+    with open(overrides_name, 'wt') as wfp:
+        json.dump(overrides, wfp, indent=2)
+
+    makefile_name = os.path.join(args.workdir, 'bench.mk')
+    subprocess.run([sys.executable, os.path.join(champsim_root, 'config.sh'), '--prefix', args.workdir, '--makefile', makefile_name, args.base_config, overrides_name],
+            cwd=champsim_root, check=True)
+    subprocess.run(['make', '-C', champsim_root, 'CONFIGURATION_MAKEFILE=' + makefile_name, '-j' + str(args.jobs), 'all_execs'], check=True)
+
+def trace_names(args, workload, num_cores):
+    trace_dir = os.path.join(args.workdir, 'traces')
+    os.makedirs(trace_dir, exist_ok=True)
+
+    # Each core runs a different program of the same kind
+    length = args.warmup_instructions + args.simulation_instructions
+    retval = []
+    for seed in range(num_cores):
+        fname = os.path.join(trace_dir, '{}-{}-{}.champsimtrace'.format(workload, seed, length))
+        if not os.path.exists(fname):
+            print('Generating', os.path.basename(fname))
+            gen_trace.write_trace(fname + '.tmp', gen_trace.WORKLOADS[workload], length, seed)
+            os.replace(fname + '.tmp', fname)
+        retval.append(fname)
+    return retval
+
+# The high-water mark of the resident set of the process. Unlike that of getrusage(), it does not carry over the size of this script,
+# from which the simulator was forked.
+def peak_rss_kib(pid):
+    try:
+        with open('/proc/{}/status'.format(pid)) as rfp:
+            for line in rfp:
+                if line.startswith('VmHWM:'):
+                    return int(line.split()[1])
+    except OSError:
+        pass
+    return 0
+
+def run(args, config, scenario):
+    workload, instr_dist, data_dist = SCENARIOS[scenario]
+    num_cores = CONFIGURATIONS[config].get('num_cores', 1)
+    traces = trace_names(args, workload, num_cores)
+
+    output_dir = os.path.join(args.workdir, 'output')
+    os.makedirs(output_dir, exist_ok=True)
+    prefix = os.path.join(output_dir, '{}-{}'.format(config, scenario))
+    env = {**os.environ, **POLICY_ENVIRONMENT,
+        'INSTR_PAGE_SIZE_DIST': str(instr_dist), 'DATA_PAGE_SIZE_DIST': str(data_dist),
+        'INSTR_PAGE_DIST_FILENAME': prefix + '.ipd', 'DATA_PAGE_DIST_FILENAME': prefix + '.dpd',
+        'PAGE_ADDRESS_STATS_FILENAME_PREFIX': prefix + '.pas', 'RECALL_DIST_FILENAME_PREFIX': prefix + '.rd'}
+    for fname in (prefix + '.ipd', prefix + '.dpd'):
+        if os.path.exists(fname):
+            os.remove(fname)
+
+    command = [os.path.join(args.workdir, 'bin', executable_name(config)),
+            '--warmup_instructions', str(args.warmup_instructions), '--simulation_instructions', str(args.simulation_instructions), *traces]
+    with open(prefix + '.txt', 'wt') as log:
+        start = time.perf_counter()
+        proc = subprocess.Popen(command, stdout=log, stderr=subprocess.STDOUT, cwd=output_dir, env=env)
+        peak_rss = 0
+        while proc.poll() is None:
+            peak_rss = max(peak_rss, peak_rss_kib(proc.pid))
+            time.sleep(0.05)
+        elapsed = time.perf_counter() - start
+
+    if proc.returncode != 0:
+        raise RuntimeError('{} failed on {}, see {}'.format(config, scenario, prefix + '.txt'))
+
+    # Count the instructions of every phase, as the simulator reports them
+    with open(prefix + '.txt') as rfp:
+        instructions = sum(int(m.group(1)) for m in re.finditer(r'finished CPU \d+ instructions: (\d+)', rfp.read()))
+
+    return {'config': config, 'scenario': scenario, 'instructions': instructions, 'seconds': elapsed,
+            'kips': instructions / elapsed / 1000, 'peak_rss_mib': peak_rss / 1024}
+
+def print_results(results, baseline):
+    baseline = {(r['config'], r['scenario']): r for r in baseline}
+    print()
+    print('{:<12} {:<10} {:>12} {:>9} {:>10} {:>14}'.format('config', 'scenario', 'instructions', 'seconds', 'KIPS', 'peak RSS (MiB)'))
+    for r in results:
+        line = '{config:<12} {scenario:<10} {instructions:>12} {seconds:>9.2f} {kips:>10.1f} {peak_rss_mib:>14.1f}'.format(**r)
+        old = baseline.get((r['config'], r['scenario']))
+        if old is not None:
+            line += '   KIPS {:+.1%}, RSS {:+.1%}'.format(r['kips'] / old['kips'] - 1, r['peak_rss_mib'] / old['peak_rss_mib'] - 1)
+        print(line)
+
+def regressions(results, baseline, threshold):
+    baseline = {(r['config'], r['scenario']): r for r in baseline}
+    return [r for r in results if (r['config'], r['scenario']) in baseline and r['kips'] < (1 - threshold) * baseline[(r['config'], r['scenario'])]['kips']]
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Measure the throughput of the simulator on synthetic traces')
+    parser.add_argument('--workdir', default=os.path.join(champsim_root, '.bench'),
+            help='The directory for the executables, traces, and results')
+    parser.add_argument('--base-config', default=os.path.join(champsim_root, 'champsim_fdip_baseline.json'),
+            help='The configuration that the benchmarked configurations modify')
+    parser.add_argument('--configs', nargs='+', choices=list(CONFIGURATIONS), default=list(CONFIGURATIONS),
+            help='The configurations to run')
+    parser.add_argument('--scenarios', nargs='+', choices=list(SCENARIOS), default=list(SCENARIOS),
+            help='The workloads to run')
+    parser.add_argument('--warmup-instructions', type=int, default=200000)
+    parser.add_argument('--simulation-instructions', type=int, default=1000000)
+    parser.add_argument('--repetitions', type=int, default=1,
+            help='The number of times to run each configuration on each workload, of which the fastest is reported')
+    parser.add_argument('--jobs', type=int, default=os.cpu_count(),
+            help='The number of parallel jobs for the build')
+    parser.add_argument('--no-build', action='store_true',
+            help='Run the executables from an earlier build')
+    parser.add_argument('--output',
+            help='The file to save the results to, by default results.json in the working directory')
+    parser.add_argument('--compare', metavar='FILE',
+            help='Results of an earlier run to compare against')
+    parser.add_argument('--threshold', type=float, default=0.05,
+            help='With --compare, the fraction by which KIPS may drop before the suite fails')
+    args = parser.parse_args()
+
+    args.workdir = os.path.abspath(args.workdir)
+    args.base_config = os.path.abspath(args.base_config)
+    os.makedirs(args.workdir, exist_ok=True)
+
+    baseline = []
+    if args.compare is not None:
+        with open(args.compare) as rfp:
+            baseline = json.load(rfp)
+
+    if not args.no_build:
+        build(args)
+
+    results = []
+    for config in args.configs:
+        for scenario in args.scenarios:
+            print('Running', config, 'on', scenario, flush=True)
+            # The fastest of the repetitions is the least disturbed by the rest of the host
+            results.append(min((run(args, config, scenario) for _ in range(args.repetitions)), key=lambda r: r['seconds']))
+
+    with open(args.output or os.path.join(args.workdir, 'results.json'), 'wt') as wfp:
+        json.dump(results, wfp, indent=2)
+
+    print_results(results, baseline)
+
+    slower = regressions(results, baseline, args.threshold)
+    for r in slower:
+        print('Regression:', r['config'], 'on', r['scenario'], file=sys.stderr)
+    sys.exit(1 if slower else 0)
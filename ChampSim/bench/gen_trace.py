@@ -0,0 +1,156 @@
+#    Copyright 2023 The ChampSim Contributors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Synthetic traces in the input_instr format, for measuring the throughput of the simulator itself.
+# The program is a random graph of basic blocks that spans the instruction footprint. Each static memory instruction either streams through
+# the data footprint or accesses it at random, and each static branch has its own type and bias, so that the predictors and prefetchers see
+# the kind of regularity they would in a real program.
+
+import argparse
+import dataclasses
+import lzma
+import random
+import struct
+
+REG_STACK_POINTER = 6
+REG_FLAGS = 25
+REG_INSTRUCTION_POINTER = 26
+GENERAL_REGISTERS = [r for r in range(1, 32) if r not in (REG_STACK_POINTER, REG_FLAGS, REG_INSTRUCTION_POINTER)]
+
+# struct input_instr in inc/trace_instruction.h
+input_instr = struct.Struct('<Q2B2B4B2Q4Q')
+
+INSTRUCTION_SIZE = 4
+CODE_BASE = 0x400000
+DATA_BASE = 0x10000000000
+MAX_CALL_DEPTH = 64
+
+@dataclasses.dataclass
+class Workload:
+    code_footprint: int          # bytes
+    data_footprint: int          # bytes
+    block_length: int = 6        # instructions per basic block, including the branch that ends it
+    memory_fraction: float = 0.3 # of the instructions that are not branches
+    store_fraction: float = 0.3  # of the memory instructions
+    random_fraction: float = 0.2 # of the memory instructions, the rest stream with a stride
+    conditional_fraction: float = 0.7 # of the branches; the rest are split among calls, returns, indirect and direct jumps
+    call_fraction: float = 0.08
+    indirect_fraction: float = 0.04
+    unpredictable_fraction: float = 0.05 # of the conditional branches, which are taken half of the time
+
+WORKLOADS = {
+    # Fits in the first-level caches and TLBs, and is easy to predict: the throughput of the core model
+    'core': Workload(code_footprint=16 << 10, data_footprint=32 << 10, random_fraction=0.1, unpredictable_fraction=0.01),
+    # A large code footprint with hard-to-predict branches: the front end and the instruction prefetchers
+    'frontend': Workload(code_footprint=4 << 20, data_footprint=256 << 10, block_length=5, unpredictable_fraction=0.3),
+    # Scattered accesses over a large data footprint: the STLB, the page walkers and DRAM
+    'stlb': Workload(code_footprint=64 << 10, data_footprint=2 << 30, memory_fraction=0.4, random_fraction=0.6),
+}
+
+class Program:
+    def __init__(self, workload, seed):
+        self.workload = workload
+        self.rng = random.Random(seed)
+        self.num_blocks = max(2, workload.code_footprint // (workload.block_length * INSTRUCTION_SIZE))
+        self.blocks = {}
+        self.memory = {}
+
+    def block(self, index):
+        # Blocks are drawn on their first visit, so that large footprints cost nothing until they are touched
+        if index not in self.blocks:
+            w, rng = self.workload, self.rng
+            kind = rng.choices(('conditional', 'call', 'return', 'indirect', 'jump'),
+                    weights=(w.conditional_fraction, w.call_fraction, w.call_fraction, w.indirect_fraction,
+                        max(0, 1 - w.conditional_fraction - 2*w.call_fraction - w.indirect_fraction)))[0]
+            bias = 0.5 if rng.random() < w.unpredictable_fraction else rng.choice((0.97, 0.03))
+            targets = [rng.randrange(self.num_blocks) for _ in range(4 if kind == 'indirect' else 1)]
+            self.blocks[index] = (kind, bias, targets)
+        return self.blocks[index]
+
+    def memory_op(self, ip):
+        if ip not in self.memory:
+            w, rng = self.workload, self.rng
+            if rng.random() >= w.memory_fraction:
+                self.memory[ip] = None
+            else:
+                is_store = rng.random() < w.store_fraction
+                stride = 0 if rng.random() < w.random_fraction else rng.choice((8, 8, 64))
+                self.memory[ip] = [is_store, stride, rng.randrange(w.data_footprint) & ~7]
+        return self.memory[ip]
+
+    def next_address(self, op):
+        if op[1] == 0:
+            return DATA_BASE + (self.rng.randrange(self.workload.data_footprint) & ~7)
+        op[2] = (op[2] + op[1]) % self.workload.data_footprint
+        return DATA_BASE + op[2]
+
+    def instructions(self, count):
+        rng = self.rng
+        block, call_stack = 0, []
+        while True:
+            base_ip = CODE_BASE + block * self.workload.block_length * INSTRUCTION_SIZE
+            for slot in range(self.workload.block_length - 1):
+                ip = base_ip + slot * INSTRUCTION_SIZE
+                op = self.memory_op(ip)
+                dst, src = rng.choice(GENERAL_REGISTERS), rng.choice(GENERAL_REGISTERS)
+                if op is None:
+                    yield input_instr.pack(ip, 0, 0, dst, 0, src, rng.choice(GENERAL_REGISTERS), 0, 0, 0, 0, 0, 0, 0, 0)
+                elif op[0]:
+                    yield input_instr.pack(ip, 0, 0, 0, 0, src, dst, 0, 0, self.next_address(op), 0, 0, 0, 0, 0)
+                else:
+                    yield input_instr.pack(ip, 0, 0, dst, 0, src, 0, 0, 0, 0, 0, self.next_address(op), 0, 0, 0)
+                count -= 1
+                if count == 0:
+                    return
+
+            ip = base_ip + (self.workload.block_length - 1) * INSTRUCTION_SIZE
+            kind, bias, targets = self.block(block)
+            fall_through = (block + 1) % self.num_blocks
+            taken = True
+            if kind == 'conditional':
+                taken = rng.random() < bias
+                yield input_instr.pack(ip, 1, taken, REG_INSTRUCTION_POINTER, 0, REG_INSTRUCTION_POINTER, REG_FLAGS, 0, 0, 0, 0, 0, 0, 0, 0)
+                block = targets[0] if taken else fall_through
+            elif kind == 'call':
+                yield input_instr.pack(ip, 1, 1, REG_INSTRUCTION_POINTER, REG_STACK_POINTER, REG_INSTRUCTION_POINTER, REG_STACK_POINTER, 0, 0, 0, 0, 0, 0, 0, 0)
+                call_stack = [*call_stack[-MAX_CALL_DEPTH+1:], fall_through]
+                block = targets[0]
+            elif kind == 'return':
+                yield input_instr.pack(ip, 1, 1, REG_INSTRUCTION_POINTER, REG_STACK_POINTER, REG_STACK_POINTER, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+                block = call_stack.pop() if call_stack else targets[0]
+            elif kind == 'indirect':
+                yield input_instr.pack(ip, 1, 1, REG_INSTRUCTION_POINTER, 0, rng.choice(GENERAL_REGISTERS), 0, 0, 0, 0, 0, 0, 0, 0, 0)
+                block = rng.choice(targets)
+            else:
+                yield input_instr.pack(ip, 1, 1, REG_INSTRUCTION_POINTER, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+                block = targets[0]
+            count -= 1
+            if count == 0:
+                return
+
+def write_trace(fname, workload, count, seed=0):
+    opener = lzma.open if fname.endswith('.xz') else open
+    with opener(fname, 'wb') as wfp:
+        for record in Program(workload, seed).instructions(count):
+            wfp.write(record)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Generate a synthetic ChampSim trace')
+    parser.add_argument('workload', choices=sorted(WORKLOADS), help='The kind of program to generate')
+    parser.add_argument('output', help='The trace file to write, compressed with xz if its name ends in .xz')
+    parser.add_argument('--instructions', type=int, default=1000000, help='The length of the trace')
+    parser.add_argument('--seed', type=int, default=0, help='Traces of the same workload and seed are identical')
+    args = parser.parse_args()
+
+    write_trace(args.output, WORKLOADS[args.workload], args.instructions, args.seed)
@@ -12,7 +12,11 @@ constexpr std::size_t COUNTER_BITS = 2;
 std::map<O3_CPU*, std::array<champsim::msl::fwcounter<COUNTER_BITS>, BIMODAL_TABLE_SIZE>> bimodal_table;
 } // namespace
 
-void O3_CPU::initialize_branch_predictor() { std::cout << "CPU " << cpu << " Bimodal branch predictor" << std::endl; }
+void O3_CPU::initialize_branch_predictor()
+{
+  std::cout << "CPU " << cpu << " Bimodal branch predictor" << std::endl;
+  champsim::register_checkpoint_state(this, "bimodal", ::bimodal_table[this]);
+}
 
 uint8_t O3_CPU::predict_branch(uint64_t ip)
 {
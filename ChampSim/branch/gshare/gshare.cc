@@ -26,7 +26,11 @@ std::size_t gs_table_hash(uint64_t ip, std::bitset<GLOBAL_HISTORY_LENGTH> bh_vec
 }
 } // namespace
 
-void O3_CPU::initialize_branch_predictor() { std::cout << "CPU " << cpu << " GSHARE branch predictor" << std::endl; }
+void O3_CPU::initialize_branch_predictor()
+{
+  std::cout << "CPU " << cpu << " GSHARE branch predictor" << std::endl;
+  champsim::register_checkpoint_state(this, "gshare", ::branch_history_vector[this], ::gs_history_table[this]);
+}
 
 uint8_t O3_CPU::predict_branch(uint64_t ip)
 {
@@ -116,6 +116,8 @@ void O3_CPU::initialize_branch_predictor()
 
   for (unsigned i = 0; i < NUM_CPUS; i++)
     theta[i] = 10;
+
+  champsim::register_checkpoint_state(this, "hashed_perceptron", tables[cpu], ghist_words[cpu], theta[cpu], tc[cpu]);
 }
 
 uint8_t O3_CPU::predict_branch(uint64_t pc)
@@ -109,7 +109,23 @@ std::map<O3_CPU*, std::bitset<PERCEPTRON_HISTORY>> global_history;      // real
                                                                         // updated
 } // namespace
 
-void O3_CPU::initialize_branch_predictor() {}
+void O3_CPU::initialize_branch_predictor()
+{
+  ::perceptrons[this];
+  ::perceptron_state_buf[this];
+  ::spec_global_history[this];
+  ::global_history[this];
+
+  // Predictions in flight are not saved, so the speculative history restarts from the real one
+  champsim::register_checkpoint_function(this, "perceptron", [this](champsim::checkpoint_archive& ar) {
+    ar.io(::perceptrons[this]);
+    ar.io(::global_history[this]);
+    if (ar.is_loading()) {
+      ::spec_global_history[this] = ::global_history[this];
+      ::perceptron_state_buf[this].clear();
+    }
+  });
+}
 
 uint8_t O3_CPU::predict_branch(uint64_t ip)
 {
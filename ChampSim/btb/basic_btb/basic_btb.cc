@@ -59,6 +59,9 @@ void O3_CPU::initialize_btb()
   std::fill(std::begin(::INDIRECT_BTB[this]), std::end(::INDIRECT_BTB[this]), 0);
   std::fill(std::begin(::CALL_SIZE[this]), std::end(::CALL_SIZE[this]), 4);
   ::CONDITIONAL_HISTORY[this] = 0;
+  ::RAS[this];
+
+  champsim::register_checkpoint_state(this, "basic_btb", ::BTB.at(this), ::INDIRECT_BTB[this], ::CONDITIONAL_HISTORY[this], ::RAS[this], ::CALL_SIZE[this]);
 }
 
 std::pair<uint64_t, uint8_t> O3_CPU::btb_prediction(uint64_t ip)
@@ -39,6 +39,8 @@ if __name__ == '__main__':
             help='The prefix for the configured outputs')
     path_group.add_argument('--bindir',
             help='The directory to store the resulting executables')
+    path_group.add_argument('--makefile',
+            help='The makefile to write, in place of _configuration.mk. Pass it to make as CONFIGURATION_MAKEFILE.')
 
     search_group = parser.add_argument_group(title='Search Paths', description='Options that direct ChampSim to search additional paths for modules')
 
@@ -74,7 +76,9 @@ if __name__ == '__main__':
             parse.parse_config(*c, module_dir=args.module_dir, branch_dir=args.branch_dir, btb_dir=args.btb_dir, pref_dir=args.prefetcher_dir, repl_dir=args.replacement_dir, compile_all_modules=args.compile_all_modules)
         for c in config_files)
 
-    with filewrite.writer(bindir_name, objdir_name) as wr:
+    makefile_name = args.makefile and os.path.abspath(os.path.expanduser(args.makefile))
+
+    with filewrite.writer(bindir_name, objdir_name, makefile_name) as wr:
         for c in parsed_configs:
             wr.write_files(c)
         wr.write_files(parsed_test, bindir_name=os.path.join(test_root, 'bin'), srcdir_names=[os.path.join(test_root, 'cpp', 'src')], objdir_name=os.path.join(objdir_name, 'test'))
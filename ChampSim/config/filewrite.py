@@ -52,7 +52,7 @@ def get_map_lines(fname_map):
     yield from ('#define {} {}'.format(*x) for x in fname_map.items())
 
 class FileWriter:
-    def __init__(self, bindir_name=None, objdir_name=None):
+    def __init__(self, bindir_name=None, objdir_name=None, makefile_name=None):
         champsim_root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
         core_sources = os.path.join(champsim_root, 'src')
 
@@ -60,6 +60,7 @@ class FileWriter:
         self.bindir_name = bindir_name
         self.core_sources = core_sources
         self.objdir_name = objdir_name
+        self.makefile_name = makefile_name or makefile_file_name
 
     def write_files(self, parsed_config, bindir_name=None, srcdir_names=None, objdir_name=None):
         local_bindir_name = bindir_name or self.bindir_name
@@ -72,8 +73,8 @@ class FileWriter:
 
         executable, elements, module_info, config_file, env = parsed_config
 
-        self.fileparts.append((os.path.join(inc_dir, instantiation_file_name), instantiation_file.get_instantiation_lines(**elements))) # Instantiation file
-        self.fileparts.append((os.path.join(inc_dir, constants_file_name), constants_file.get_constants_file(config_file, elements['pmem']))) # Constants header
+        self.fileparts.append((os.path.join(inc_dir, instantiation_file_name), instantiation_file.get_environment_lines(elements))) # Instantiation file
+        self.fileparts.append((os.path.join(inc_dir, constants_file_name), constants_file.get_constants_file(config_file, elements[0]['pmem']))) # Constants header
 
         # Core modules file
         branch_declarations, branch_definitions = modules.get_branch_lines(module_info['branch'])
@@ -99,7 +100,7 @@ class FileWriter:
 
         joined_module_info = util.chain(*module_info.values()) # remove module type tag
         self.fileparts.extend((os.path.join(inc_dir, m['name'] + '.inc'), get_map_lines(m['func_map'])) for m in joined_module_info.values())
-        self.fileparts.append((makefile_file_name, makefile.get_makefile_lines(local_objdir_name, build_id, os.path.normpath(os.path.join(local_bindir_name, executable)), local_srcdir_names, joined_module_info, env)))
+        self.fileparts.append((self.makefile_name, makefile.get_makefile_lines(local_objdir_name, build_id, os.path.normpath(os.path.join(local_bindir_name, executable)), local_srcdir_names, joined_module_info, env)))
 
     def finish(self):
         for fname, fcontents in itertools.groupby(sorted(self.fileparts, key=operator.itemgetter(0)), key=operator.itemgetter(0)):
@@ -115,8 +116,8 @@ class FileWriter:
 
 
 @contextlib.contextmanager
-def writer(bindir_name=None, objdir_name=None):
-    w = FileWriter(bindir_name, objdir_name)
+def writer(bindir_name=None, objdir_name=None, makefile_name=None):
+    w = FileWriter(bindir_name, objdir_name, makefile_name)
     try:
         yield w
     finally:
@@ -19,7 +19,7 @@ from . import util
 
 ptw_fmtstr = 'PageTableWalker {name}("{name}", {cpu}, {frequency}, {{{{{pscl5_set}, {pscl5_way}}}, {{{pscl4_set}, {pscl4_way}}}, {{{pscl3_set}, {pscl3_way}}}, {{{pscl2_set}, {pscl2_way}}}}}, {ptw_rq_size}, {ptw_mshr_size}, {ptw_max_read}, {ptw_max_write}, 1, &{lower_level}, vmem);'
 
-cpu_fmtstr = '{{{index}, {frequency}, {{{DIB[sets]}, {DIB[ways]}, {{champsim::lg2({DIB[window_size]})}}, {{champsim::lg2({DIB[window_size]})}}}}, {ifetch_buffer_size}, {dispatch_buffer_size}, {decode_buffer_size}, {rob_size}, {lq_size}, {sq_size}, {fetch_width}, {decode_width}, {dispatch_width}, {scheduler_size}, {execute_width}, {lq_width}, {sq_width}, {retire_width}, {mispredict_penalty}, {decode_latency}, {dispatch_latency}, {schedule_latency}, {execute_latency}, &{L1I}, {L1I}.MAX_TAG, &{L1D}, {L1D}.MAX_TAG, {branch_enum_string}, {btb_enum_string}}}'
+cpu_fmtstr = '{{{index}, {frequency}, {{{DIB[sets]}, {DIB[ways]}, {{champsim::lg2({DIB[window_size]})}}, {{champsim::lg2({DIB[window_size]})}}}}, {ifetch_buffer_size}, {dispatch_buffer_size}, {decode_buffer_size}, {rob_size}, {lq_size}, {sq_size}, {fetch_width}, {decode_width}, {dispatch_width}, {scheduler_size}, {execute_width}, {lq_width}, {sq_width}, {retire_width}, {mispredict_penalty}, {decode_latency}, {dispatch_latency}, {schedule_latency}, {execute_latency}, &{L1I}, {L1I}.MAX_TAG, &{L1D}, {L1D}.MAX_TAG, {branch_enum_string}, {btb_enum_string}, {smt_threads}, {smt_partitioned:b}, {physical_registers}, {FDIP[aggressiveness]}, {FDIP[run_ahead]}, {FDIP[ftq_size]}, {FDIP[decoupled]:b}, {FDIP[wrong_path_blocks]}}}'
 
 pmem_fmtstr = 'MEMORY_CONTROLLER {name}({frequency}, {io_freq}, {tRP}, {tRCD}, {tCAS}, {turn_around_time});'
 vmem_fmtstr = 'VirtualMemory vmem({pte_page_size}, {num_levels}, {minor_fault_penalty}, {dram_name});'
@@ -36,6 +36,13 @@ queue_fmtstr = 'CACHE::{_type} {name}_queues{{{frequency}, {rq_size}, {pq_size},
 def get_instantiation_lines(cores, caches, ptws, pmem, vmem):
     memory_system = {c['name']:c for c in itertools.chain(caches, ptws)}
 
+    # A cache that only one core reaches sees the branch history of that core
+    reached_from = {}
+    for cpu,name in itertools.product(cores, ('ITLB', 'DTLB', 'L1I', 'L1D')):
+        for elem in util.iter_system(memory_system, cpu[name]):
+            reached_from.setdefault(elem['name'], set()).add(cpu['name'])
+    private_caches = {n: next(iter(c)) for n,c in reached_from.items() if len(c) == 1 and 'pscl5_set' not in memory_system[n]}
+
     # Give each element a fill level
     fill_levels = itertools.chain(*(enumerate(c['name'] for c in util.iter_system(memory_system, cpu[name])) for cpu,name in itertools.product(cores, ('ITLB', 'DTLB', 'L1I', 'L1D'))))
     fill_levels = sorted(fill_levels, key=operator.itemgetter(1))
@@ -89,5 +96,27 @@ def get_instantiation_lines(cores, caches, ptws, pmem, vmem):
 
     yield 'void init_structures() {'
     yield from ('  {name}_queues.lower_level = &{lower_translate};'.format(**elem) for elem in memory_system if elem.get('_needs_translate'))
+    yield '#if defined(TRACK_BRANCH_HISTORY)'
+    yield from ('  {}.branch_history = &{}.branch_history;'.format(name, cpu) for name,cpu in private_caches.items())
+    yield '#endif'
     yield '}'
 
+
+def get_environment_lines(instances):
+    environment_fmtstr = '{{"{name}", {prefix}ooo_cpu, {prefix}caches, {prefix}ptws, {prefix}operables, {prefix}{pmem[name]}, {prefix}init_structures}}'
+
+    # A fan-out build places each configuration in a namespace of its own
+    if len(instances) == 1 and 'namespace' not in instances[0]:
+        yield from get_instantiation_lines(**util.subdict(instances[0], ('cores', 'caches', 'ptws', 'pmem', 'vmem')))
+        environments = [environment_fmtstr.format(name='', prefix='', **instances[0])]
+    else:
+        for inst in instances:
+            yield 'namespace {namespace} {{'.format(**inst)
+            yield from get_instantiation_lines(**util.subdict(inst, ('cores', 'caches', 'ptws', 'pmem', 'vmem')))
+            yield '}'
+            yield ''
+        environments = [environment_fmtstr.format(prefix=inst['namespace']+'::', **inst) for inst in instances]
+
+    yield 'std::vector<champsim::environment> environments {{'
+    yield ',\n'.join(environments)
+    yield '}};'
@@ -12,17 +12,20 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import fractions
 import itertools
 import os
 import math
 
+from . import constants_file
 from . import defaults
 from . import modules
 from . import util
 
 default_root = { 'block_size': 64, 'page_size': 4096, 'heartbeat_frequency': 10000000, 'num_cores': 1 }
-default_core = { 'frequency' : 4000, 'ifetch_buffer_size': 64, 'decode_buffer_size': 32, 'dispatch_buffer_size': 32, 'rob_size': 352, 'lq_size': 128, 'sq_size': 72, 'fetch_width' : 6, 'decode_width' : 6, 'dispatch_width' : 6, 'execute_width' : 4, 'lq_width' : 2, 'sq_width' : 2, 'retire_width' : 5, 'mispredict_penalty' : 1, 'scheduler_size' : 128, 'decode_latency' : 1, 'dispatch_latency' : 1, 'schedule_latency' : 0, 'execute_latency' : 0, 'branch_predictor': 'bimodal', 'btb': 'basic_btb' }
+default_core = { 'frequency' : 4000, 'ifetch_buffer_size': 64, 'decode_buffer_size': 32, 'dispatch_buffer_size': 32, 'rob_size': 352, 'lq_size': 128, 'sq_size': 72, 'fetch_width' : 6, 'decode_width' : 6, 'dispatch_width' : 6, 'execute_width' : 4, 'lq_width' : 2, 'sq_width' : 2, 'retire_width' : 5, 'mispredict_penalty' : 1, 'scheduler_size' : 128, 'decode_latency' : 1, 'dispatch_latency' : 1, 'schedule_latency' : 0, 'execute_latency' : 0, 'branch_predictor': 'bimodal', 'btb': 'basic_btb', 'smt_threads': 1, 'smt_partitioned': True, 'physical_registers': 0 }
 default_dib  = { 'window_size': 16,'sets': 32, 'ways': 8 }
+default_fdip = { 'aggressiveness': 16, 'run_ahead': 64, 'ftq_size': 64, 'decoupled': False, 'wrong_path_blocks': 4 }
 default_pmem = { 'name': 'DRAM', 'frequency': 3200, 'channels': 1, 'ranks': 1, 'banks': 8, 'rows': 65536, 'columns': 128, 'lines_per_column': 8, 'channel_width': 8, 'wq_size': 64, 'rq_size': 64, 'tRP': 12.5, 'tRCD': 12.5, 'tCAS': 12.5, 'turn_around_time': 7.5 }
 default_vmem = { 'pte_page_size': (1 << 12), 'num_levels': 5, 'minor_fault_penalty': 200 }
 
@@ -33,13 +36,49 @@ def upper_levels_for(system, names):
     yield from ((k,v) for k,v in upper_levels if k in names)
 
 # Scale frequencies
+# Each element is given as an exact ratio of cycles of the fastest clock to cycles of its own clock
+# The longest pattern of clock ratios that the simulator's clock schedule can lay out, in cycles of the fastest clock
+max_schedule_period = 1 << 20
+
 def scale_frequencies(it):
     it_a, it_b = itertools.tee(it, 2)
     max_freq = max(x['frequency'] for x in it_a)
+    schedule_period = 1
     for x in it_b:
-        x['frequency'] = max_freq / x['frequency']
-
-def parse_config(*configs, module_dir=[], branch_dir=[], btb_dir=[], pref_dir=[], repl_dir=[], compile_all_modules=False):
+        ratio = (fractions.Fraction(max_freq) / fractions.Fraction(x['frequency'])).limit_denominator(1 << 16)
+        schedule_period = schedule_period * ratio.numerator // math.gcd(schedule_period, ratio.numerator)
+        if schedule_period > max_schedule_period:
+            raise ValueError('With the frequency {} of {}, the clock ratios repeat only after {} cycles of the fastest clock, more than the {} that the simulator can schedule. Choose frequencies with simpler ratios.'.format(x['frequency'], x['name'], schedule_period, max_schedule_period))
+        x['frequency'] = 'champsim::clock_ratio{{{}, {}}}'.format(ratio.numerator, ratio.denominator)
+
+# A configuration with a "fanout" list builds one executable that simulates every listed variant over the same traces.
+# Each variant is applied to the rest of the configuration as if it were one more configuration file, of the highest priority.
+def parse_config(*configs, **kwargs):
+    variants = list(itertools.chain(*(util.wrap_list(c['fanout']) for c in configs if 'fanout' in c)))
+    if not variants:
+        return parse_single_config(*configs, **kwargs)
+
+    base_configs = [util.subdict(c, [k for k in c if k != 'fanout']) for c in configs]
+    executable, _, _, _, env = parse_single_config(*base_configs, **kwargs)
+
+    instances = []
+    module_info = {}
+    constants = None
+    for i,variant in enumerate(variants):
+        _, (elements,), variant_modules, config_file, _ = parse_single_config(util.subdict(variant, [k for k in variant if k != 'name']), *base_configs, **kwargs)
+
+        # The variants share one build, so they must agree on everything that is compiled in as a constant
+        variant_constants = list(constants_file.get_constants_file(config_file, elements['pmem']))
+        if constants is not None and variant_constants != constants:
+            raise ValueError('Fan-out variant {} changes a compile-time constant (block_size, page_size, num_cores, or the DRAM geometry)'.format(variant.get('name', i)))
+        constants = variant_constants
+
+        instances.append({**elements, 'name': variant.get('name', 'config'+str(i)), 'namespace': 'fanout'+str(i)})
+        module_info = {k: {**module_info.get(k, {}), **v} for k,v in variant_modules.items()}
+
+    return executable, instances, module_info, config_file, env
+
+def parse_single_config(*configs, module_dir=[], branch_dir=[], btb_dir=[], pref_dir=[], repl_dir=[], compile_all_modules=False):
     name_parts = ['champsim', *(c.get('name') for c in configs if c.get('name') is not None)]
 
     champsim_root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
@@ -60,7 +99,7 @@ def parse_config(*configs, module_dir=[], branch_dir=[], btb_dir=[], pref_dir=[]
     cores = list(itertools.islice(itertools.chain.from_iterable(itertools.repeat(c, cpu_repeat_factor) for c in cores), config_file['num_cores']))
 
     # Default core elements
-    cores = [util.chain(cpu, {'name': 'cpu'+str(i), 'index': i, 'DIB': config_file.get('DIB',{})}, {'DIB': default_dib}, default_core) for i,cpu in enumerate(cores)]
+    cores = [util.chain(cpu, {'name': 'cpu'+str(i), 'index': i, 'DIB': config_file.get('DIB',{}), 'FDIP': config_file.get('FDIP',{})}, {'DIB': default_dib, 'FDIP': default_fdip}, default_core) for i,cpu in enumerate(cores)]
 
     # Establish defaults for first-level caches
     caches = util.combine_named(
@@ -164,7 +203,7 @@ def parse_config(*configs, module_dir=[], branch_dir=[], btb_dir=[], pref_dir=[]
         branch_data = util.subdict(branch_data, list(itertools.chain(*(c['_branch_predictor_modnames'] for c in cores))))
         btb_data = util.subdict(btb_data, list(itertools.chain(*(c['_btb_modnames'] for c in cores))))
 
-    elements = {'cores': cores, 'caches': tuple(caches.values()), 'ptws': tuple(ptws.values()), 'pmem': pmem, 'vmem': vmem}
+    elements = [{'cores': cores, 'caches': tuple(caches.values()), 'ptws': tuple(ptws.values()), 'pmem': pmem, 'vmem': vmem}]
     module_info = {'repl': dict(repl_data.items()), 'pref': dict(pref_data.items()), 'branch': dict(branch_data.items()), 'btb': dict(btb_data.items())}
 
     executable = config_file.get('executable_name', '_'.join(name_parts))
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "champsim.h"
+#include "checkpoint.h"
 #include "champsim_constants.h"
 #include "memory_class.h"
 #include "operable.h"
@@ -44,13 +45,8 @@
 #include <cmath>
 #endif
 
-#if defined TRACK_BRANCH_HISTORY 
-extern uint64_t global_path_history_MHRP;
-extern uint64_t global_path_history;
-extern uint64_t uncondIndHistory;
-extern uint64_t condHistory;
-extern uint64_t uncondIndHistory_old;
-extern uint64_t condHistory_old;
+#if defined TRACK_BRANCH_HISTORY
+#include "history_tracker.h"
 #endif
 
 struct cache_stats {
@@ -185,7 +181,7 @@ public:
 
     std::vector<stats_type> sim_stats, roi_stats;
 
-    NonTranslatingQueues(double freq_scale, std::size_t rq_size, std::size_t pq_size, std::size_t wq_size, std::size_t ptwq_size, uint64_t hit_latency,
+    NonTranslatingQueues(champsim::clock_ratio freq_scale, std::size_t rq_size, std::size_t pq_size, std::size_t wq_size, std::size_t ptwq_size, uint64_t hit_latency,
                          unsigned offset_bits, bool match_offset)
         : champsim::operable(freq_scale), RQ_SIZE(rq_size), PQ_SIZE(pq_size), WQ_SIZE(wq_size), PTWQ_SIZE(ptwq_size), HIT_LATENCY(hit_latency),
           OFFSET_BITS(offset_bits), match_offset_bits(match_offset)
@@ -202,6 +198,8 @@ public:
     bool add_ptwq(const PACKET& packet);
 
     virtual bool is_ready(const PACKET& pkt) const;
+    virtual uint64_t ready_cycle(const PACKET& pkt) const;
+    virtual void functional_translate(functional_request&) {}
 
     bool rq_has_ready() const;
     bool wq_has_ready() const;
@@ -210,6 +208,7 @@ public:
 
     void begin_phase() override;
     void end_phase(unsigned cpu) override;
+    uint64_t next_event_cycle() const override;
 
   private:
     void check_collision();
@@ -228,6 +227,9 @@ public:
     void do_detect_misses(R& queue);
 
     virtual bool is_ready(const PACKET& pkt) const override final;
+    virtual uint64_t ready_cycle(const PACKET& pkt) const override final;
+    void functional_translate(functional_request& request) override final;
+    uint64_t next_event_cycle() const override final;
 
     void return_data(const PACKET& packet) override final;
 
@@ -235,6 +237,9 @@ public:
   };
 
   uint32_t cpu = 0;
+#if defined TRACK_BRANCH_HISTORY
+  const champsim::branch_history* branch_history = nullptr; // of the core, if the cache is private to one
+#endif
   const std::string NAME;
   const uint32_t NUM_SET, NUM_WAY, MSHR_SIZE;
   const uint32_t FILL_LATENCY;
@@ -266,9 +271,11 @@ public:
   bool add_wq(const PACKET& packet) override final;
   bool add_pq(const PACKET& packet) override final;
   bool add_ptwq(const PACKET& packet) override final;
+  uint64_t functional_access(const functional_request& request) override final;
 
   void return_data(const PACKET& packet) override final;
   void operate() override final;
+  uint64_t next_event_cycle() const override final;
 
   void initialize() override final;
   void begin_phase() override final;
@@ -294,6 +301,7 @@ public:
   bool should_activate_prefetcher(const PACKET& pkt) const;
 
   void print_deadlock() override;
+  void serialize(champsim::checkpoint_archive& ar);
 
 #include "cache_modules.inc"
 
@@ -305,11 +313,16 @@ public:
 	bool force_hit = false; 
 	bool force_mon = false;
 	VirtualMemory	*vmem;
+
+	// What the name says the cache is, looked up once for the functional accesses
+	const bool is_tlb = NAME.find("STLB") != std::string::npos || NAME.find("DTLB") != std::string::npos || NAME.find("ITLB") != std::string::npos;
+	const bool is_stlb = NAME.find("STLB") != std::string::npos;
+	const bool is_l1d = NAME.find("L1D") != std::string::npos;
 #endif
 
 // constructor
 #if defined FORCE_HIT || defined FORCE_PTE_HIT || defined MULTIPLE_PAGE_SIZE
-  CACHE(std::string v1, double freq_scale, uint32_t v2, uint32_t v3, uint32_t v8, 
+  CACHE(std::string v1, champsim::clock_ratio freq_scale, uint32_t v2, uint32_t v3, uint32_t v8, 
 				uint32_t fill_lat, long int max_tag, long int max_fill, unsigned offset_bits, 
         bool pref_load, bool wq_full_addr, bool va_pref, unsigned pref_mask, 
 				NonTranslatingQueues& queue_set, MemoryRequestConsumer* ll,
@@ -322,7 +335,7 @@ public:
 				virtual_prefetch(va_pref), pref_activate_mask(pref_mask), queues(queue_set), repl_type(repl), 
 				pref_type(pref), force_hit(_force_hit), force_mon(_force_mon), vmem(_vmem)
 #else
-  CACHE(std::string v1, double freq_scale, uint32_t v2, uint32_t v3, uint32_t v8, uint32_t fill_lat, long int max_tag, long int max_fill, unsigned offset_bits,
+  CACHE(std::string v1, champsim::clock_ratio freq_scale, uint32_t v2, uint32_t v3, uint32_t v8, uint32_t fill_lat, long int max_tag, long int max_fill, unsigned offset_bits,
         bool pref_load, bool wq_full_addr, bool va_pref, unsigned pref_mask, NonTranslatingQueues& queue_set, MemoryRequestConsumer* ll,
         std::bitset<NUM_PREFETCH_MODULES> pref, std::bitset<NUM_REPLACEMENT_MODULES> repl)
       : champsim::operable(freq_scale), MemoryRequestProducer(ll), NAME(v1), NUM_SET(v2), NUM_WAY(v3), MSHR_SIZE(v8), FILL_LATENCY(fill_lat),
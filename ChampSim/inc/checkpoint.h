@@ -0,0 +1,238 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "operable.h"
+
+namespace champsim
+{
+
+struct checkpoint_config {
+  std::string save_path; // written once the warmup phase completes
+  std::string load_path; // read in place of the warmup phase
+};
+
+// Thrown when saved state does not fit the component it is loaded into
+struct checkpoint_mismatch : public std::runtime_error {
+  using std::runtime_error::runtime_error;
+};
+
+/*
+ * Reads or writes the state of one component.
+ * A component describes its state once, as a sequence of calls to io(), and the same description serves to save and to restore it.
+ */
+class checkpoint_archive
+{
+  std::string& buffer;
+  std::size_t position = 0;
+  const bool loading;
+
+  void raw(void* data, std::size_t size);
+
+  template <typename C>
+  std::size_t io_size(const C& container)
+  {
+    uint64_t size = std::size(container);
+    io(size);
+    return static_cast<std::size_t>(size);
+  }
+
+public:
+  checkpoint_archive(std::string& buf, bool load) : buffer(buf), loading(load) {}
+
+  bool is_loading() const { return loading; }
+  bool finished() const { return position == std::size(buffer); }
+
+  // A parameter of the configuration that the saved and the loading simulator must agree on
+  template <typename T>
+  void expect(const T& value)
+  {
+    T saved = value;
+    io(saved);
+    if (loading && !(saved == value))
+      throw checkpoint_mismatch{"component geometry differs from the checkpoint"};
+  }
+
+  template <typename T>
+  void io(T& value)
+  {
+    if constexpr (std::is_trivially_copyable_v<T>)
+      raw(&value, sizeof(T));
+    else
+      value.serialize(*this);
+  }
+
+  void io(std::string& value)
+  {
+    auto size = io_size(value);
+    value.resize(size);
+    raw(std::data(value), size);
+  }
+
+  template <typename T, typename U>
+  void io(std::pair<T, U>& value)
+  {
+    io(value.first);
+    io(value.second);
+  }
+
+  template <typename... Ts>
+  void io(std::tuple<Ts...>& value)
+  {
+    std::apply([this](auto&... elems) { (io(elems), ...); }, value);
+  }
+
+  template <typename T>
+  void io(std::optional<T>& value)
+  {
+    bool engaged = value.has_value();
+    io(engaged);
+    if (loading && engaged != value.has_value())
+      value = engaged ? std::optional<T>{T{}} : std::nullopt;
+    if (engaged)
+      io(*value);
+  }
+
+  template <typename T, std::size_t N>
+  void io(std::array<T, N>& value)
+  {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      raw(std::data(value), sizeof(value));
+    } else {
+      for (auto& elem : value)
+        io(elem);
+    }
+  }
+
+  // Tables are sized by the configuration and must match; empty vectors take the saved size
+  template <typename T, typename A>
+  void io(std::vector<T, A>& value)
+  {
+    auto size = io_size(value);
+    if (loading && size != std::size(value)) {
+      if constexpr (std::is_default_constructible_v<T>) {
+        if (!std::empty(value))
+          throw checkpoint_mismatch{"table size differs from the checkpoint"};
+        value.resize(size);
+      } else {
+        throw checkpoint_mismatch{"table size differs from the checkpoint"};
+      }
+    }
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      raw(std::data(value), size * sizeof(T));
+    } else {
+      for (auto& elem : value)
+        io(elem);
+    }
+  }
+
+  template <typename A>
+  void io(std::vector<bool, A>& value)
+  {
+    auto size = io_size(value);
+    if (loading && size != std::size(value)) {
+      if (!std::empty(value))
+        throw checkpoint_mismatch{"table size differs from the checkpoint"};
+      value.resize(size);
+    }
+
+    for (std::size_t i = 0; i < size; ++i) {
+      bool bit = value[i];
+      io(bit);
+      value[i] = bit;
+    }
+  }
+
+  template <typename T, typename A>
+  void io(std::deque<T, A>& value)
+  {
+    auto size = io_size(value);
+    if (loading)
+      value.resize(size);
+    for (auto& elem : value)
+      io(elem);
+  }
+
+  template <typename M>
+  void io_map(M& value)
+  {
+    auto size = io_size(value);
+    if (loading) {
+      value.clear();
+      for (std::size_t i = 0; i < size; ++i) {
+        std::pair<typename M::key_type, typename M::mapped_type> elem{};
+        io(elem);
+        value.insert(std::move(elem));
+      }
+    } else {
+      for (const auto& [key, mapped] : value) {
+        auto key_copy = key;
+        io(key_copy);
+        io(const_cast<typename M::mapped_type&>(mapped));
+      }
+    }
+  }
+
+  template <typename K, typename V, typename C, typename A>
+  void io(std::map<K, V, C, A>& value)
+  {
+    io_map(value);
+  }
+
+  template <typename K, typename V, typename H, typename E, typename A>
+  void io(std::unordered_map<K, V, H, E, A>& value)
+  {
+    io_map(value);
+  }
+};
+
+/*
+ * Modules keep their state outside of the component they belong to, usually in a map keyed by the owning CACHE or O3_CPU.
+ * Registering that state, typically from the module's initialization function, saves and restores it along with its owner.
+ * The tag names the state within the owner, so that a checkpoint taken with a different module leaves this one cold.
+ */
+void register_checkpoint_function(const void* owner, std::string tag, std::function<void(checkpoint_archive&)> func);
+
+template <typename... Ts>
+void register_checkpoint_state(const void* owner, std::string tag, Ts&... state)
+{
+  register_checkpoint_function(owner, std::move(tag), [&state...](checkpoint_archive& ar) { (ar.io(state), ...); });
+}
+
+// The checkpoint also records the number of cycles of the fastest clock that have elapsed, which is returned on loading
+void save_checkpoint(const std::string& path, uint64_t elapsed_cycles, std::vector<std::reference_wrapper<operable>>& operables);
+uint64_t load_checkpoint(const std::string& path, std::vector<std::reference_wrapper<operable>>& operables);
+
+} // namespace champsim
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLOCK_SCHEDULE_H
+#define CLOCK_SCHEDULE_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "operable.h"
+
+namespace champsim
+{
+
+/*
+ * The order in which a set of components operate on each cycle of the fastest clock.
+ * The clock ratios are fixed, so the pattern repeats and is computed once, up front.
+ * Within a cycle, components that have fallen furthest behind operate first, and tied components keep the order of the cycle before.
+ * That order may take a few periods to settle, so the calendar can begin with a prefix that does not repeat.
+ */
+class clock_schedule
+{
+  std::vector<std::reference_wrapper<operable>> members;
+  std::vector<clock_ratio> ratios;
+  std::vector<std::vector<std::size_t>> calendar;
+  std::size_t loop_start = 0;     // where the calendar resumes after its last cycle
+  std::size_t operate_period = 1; // the cycles after which the same members operate again, whatever their order
+  std::size_t position = 0;
+
+  std::size_t index_of(uint64_t elapsed_cycles) const;
+
+public:
+  // The schedule resumes from the current cycles of its members
+  explicit clock_schedule(std::vector<std::reference_wrapper<operable>> ops);
+
+  // The number of cycles of the fastest clock after which the schedule repeats, once past its prefix
+  std::size_t period() const { return std::size(calendar) - loop_start; }
+
+  // Indices of the components that operate on the coming cycle, in order
+  const std::vector<std::size_t>& next() const { return calendar[position]; }
+  void advance()
+  {
+    if (++position == std::size(calendar))
+      position = loop_start;
+  }
+
+  // The number of cycles of the fastest clock that the members have run for
+  uint64_t elapsed() const;
+
+  // Set the clock of every member as if the given number of cycles of the fastest clock had been simulated
+  void seek(uint64_t elapsed_cycles);
+
+  operable& at(std::size_t idx) const { return members[idx]; }
+  std::size_t size() const { return std::size(members); }
+};
+
+} // namespace champsim
+
+#endif
@@ -75,10 +75,11 @@ class MEMORY_CONTROLLER : public champsim::operable, public MemoryRequestConsume
 public:
   std::array<DRAM_CHANNEL, DRAM_CHANNELS> channels;
 
-  MEMORY_CONTROLLER(double freq_scale, int io_freq, double t_rp, double t_rcd, double t_cas, double turnaround);
+  MEMORY_CONTROLLER(champsim::clock_ratio freq_scale, int io_freq, double t_rp, double t_rcd, double t_cas, double turnaround);
 
   void initialize() override final;
   void operate() override final;
+  uint64_t next_event_cycle() const override final;
   void begin_phase() override final;
   void end_phase(unsigned cpu) override final;
 
@@ -87,16 +88,19 @@ public:
   bool add_pq(const PACKET& packet) override final;
   bool add_ptwq(const PACKET&) override final { assert(0); }
 
+  // The row buffers are not warmed
+  uint64_t functional_access(const functional_request& request) override final { return request.data; }
+
   std::size_t get_occupancy(uint8_t queue_type, uint64_t address) override final;
   std::size_t get_size(uint8_t queue_type, uint64_t address) override final;
 
   std::size_t size() const;
 
-  uint32_t dram_get_channel(uint64_t address);
-  uint32_t dram_get_rank(uint64_t address);
-  uint32_t dram_get_bank(uint64_t address);
-  uint32_t dram_get_row(uint64_t address);
-  uint32_t dram_get_column(uint64_t address);
+  uint32_t dram_get_channel(uint64_t address) const;
+  uint32_t dram_get_rank(uint64_t address) const;
+  uint32_t dram_get_bank(uint64_t address) const;
+  uint32_t dram_get_row(uint64_t address) const;
+  uint32_t dram_get_column(uint64_t address) const;
 };
 
 #endif
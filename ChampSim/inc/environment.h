@@ -0,0 +1,46 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ENVIRONMENT_H
+#define ENVIRONMENT_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "cache.h"
+#include "dram_controller.h"
+#include "ooo_cpu.h"
+#include "operable.h"
+#include "ptw.h"
+
+namespace champsim
+{
+
+// One simulated system, as instantiated by the configuration
+struct environment {
+  std::string name; // empty unless the build fans out over several configurations
+  std::vector<std::reference_wrapper<O3_CPU>> cpus;
+  std::vector<std::reference_wrapper<CACHE>> caches;
+  std::vector<std::reference_wrapper<PageTableWalker>> ptws;
+  std::vector<std::reference_wrapper<operable>> operables;
+  std::reference_wrapper<MEMORY_CONTROLLER> dram;
+  void (*init_structures)();
+};
+
+} // namespace champsim
+
+#endif
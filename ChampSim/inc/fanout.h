@@ -0,0 +1,40 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FANOUT_H
+#define FANOUT_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "environment.h"
+
+namespace champsim
+{
+
+/*
+ * Simulates every configuration over a single reading of the traces.
+ * Each configuration runs in a process of its own, because modules keep state in globals. The traces are decompressed once, by
+ * this process, and streamed to every configuration. The function is given the configuration and the names under which it reads
+ * the streams in place of the trace files, and what it prints is reported in the order of the configurations once all complete.
+ */
+int fanout_main(std::vector<environment>& environments, const std::vector<std::string>& trace_files,
+                std::function<int(environment&, std::vector<std::string>)> run);
+
+} // namespace champsim
+
+#endif
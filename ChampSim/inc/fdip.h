@@ -1,92 +1,117 @@
-#include <queue>
-#include <map>
+#ifndef FDIP_H
+#define FDIP_H
+
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <assert.h>
-#include "instruction.h"
+#include "champsim_constants.h"
 
 class FDIP {
   private:
-    std::deque<ooo_model_instr> BUFFER;
-    const uint32_t width;
-    const uint32_t offset;
+    // The fetch target queue: a ring of the addresses of the blocks to prefetch, each the address of the first instruction seen in it
+    struct ftq_entry {
+        uint64_t ip = 0;
+        uint8_t thread = 0;
+        bool wrong_path = false; // queued by the branch prediction unit after a branch it mispredicted
+    };
+    std::vector<ftq_entry> ftq;
+    std::size_t ftq_head = 0;
+    std::size_t ftq_occupancy = 0;
+    std::unordered_set<uint64_t> queued_blocks;
+
+    // The instructions of each block in the IFETCH_BUFFER that are fetched or being fetched
+    std::unordered_map<uint64_t, uint32_t> fetched_blocks;
+
     const uint32_t aggressivity;
-    const uint32_t prune_factor;
-    uint64_t last_added_instr_id; 
+    const std::size_t run_ahead;
+    const std::size_t wrong_path_blocks;
+    uint64_t last_added_instr_id = 0;
     bool enabled;
-
-    // stats
-    std::map<uint64_t, uint64_t> inflight_mops;
-    uint64_t mops;
-    uint64_t cycles;
+    bool decoupled;
 
   public:
-    FDIP(uint64_t agg) : width(6), offset(10*width), aggressivity(agg), prune_factor(0), enabled (agg > 0) {
-        last_added_instr_id = 0;
-        mops = 0;
-        cycles = 0;
+    FDIP(uint32_t agg, std::size_t run_ahead_depth, std::size_t ftq_size, bool decoupled_bpu, std::size_t wrong_path_depth)
+        : ftq(ftq_size), aggressivity(agg), run_ahead(run_ahead_depth), wrong_path_blocks(wrong_path_depth), enabled(agg > 0 && run_ahead_depth > 0 && ftq_size > 0),
+          decoupled(enabled && decoupled_bpu) {
         std::cout << "FDiP ";
-        if (enabled) std::cout << "enabled with aggresivity " << aggressivity;
+        if (enabled) std::cout << "enabled with aggresivity " << aggressivity << ", run-ahead " << run_ahead << " and FTQ size " << std::size(ftq);
         else std::cout << "disabled";
+        if (decoupled) std::cout << ", driven by a decoupled branch prediction unit that runs " << wrong_path_blocks << " blocks down a wrong path";
         std::cout << std::endl;
     };
-    ~FDIP() {};
 
-    uint32_t    getAggresivity()    { return aggressivity;}
-    uint32_t    getOffset()         { return offset;}
-    uint32_t    getWidth()          { return width;}
-    auto        getLastAddedInstr() { return last_added_instr_id;}
-    bool        empty()             { return BUFFER.empty();}
-    bool        isEnabled()         { return enabled; }
+    uint32_t    getAggresivity() const    { return aggressivity;}
+    std::size_t getRunAhead() const       { return run_ahead;}
+    std::size_t getWrongPathBlocks() const { return wrong_path_blocks;}
+    std::size_t getSize() const           { return std::size(ftq);}
+    auto        getLastAddedInstr() const { return last_added_instr_id;}
+    bool        empty() const             { return ftq_occupancy == 0;}
+    bool        full() const              { return ftq_occupancy == std::size(ftq);}
+    bool        isEnabled() const         { return enabled; }
+    bool        isDecoupled() const       { return decoupled; }
 
     /*
-     * Prune the top of the BUFFER to avoid too close 
-     * prefetches
+     * Queue the block of an instruction, unless it is queued already.
+     * Returns false, and leaves the instruction to a later cycle, if the FTQ is full.
      */
-    void prune() {
-        for (uint32_t i = 0; i < prune_factor; ++i){
-            if (empty()) return;
-            BUFFER.pop_front();
-        }
+    template <typename It>
+    bool push_back(It instr) {
+        if (!push_block(instr->ip, instr->thread, false)) return false;
+        last_added_instr_id = instr->instr_id;
+        return true;
     }
 
-    void push_back(std::deque<ooo_model_instr>::iterator instr) {
-        last_added_instr_id = instr->instr_id;
-        // filter same block instr
-        uint64_t ip = instr->ip;
-        if (std::find_if(   std::begin(BUFFER), 
-                            std::end(BUFFER), 
-                            [ip] (auto x) { 
-                                return ((ip >> LOG2_BLOCK_SIZE) == (x.ip >> LOG2_BLOCK_SIZE));
-                            }) == std::end(BUFFER)){
-            BUFFER.push_back(*instr);
+    bool push_block(uint64_t ip, uint8_t thread, bool wrong_path) {
+        if (queued_blocks.count(ip >> LOG2_BLOCK_SIZE) == 0) {
+            if (full()) return false;
+            ftq[(ftq_head + ftq_occupancy) % std::size(ftq)] = {ip, thread, wrong_path};
+            ++ftq_occupancy;
+            queued_blocks.insert(ip >> LOG2_BLOCK_SIZE);
         }
+        return true;
     }
 
-    std::pair<uint64_t, uint64_t> get_prefetch_line() {
+    uint64_t get_prefetch_line() {
         assert(!empty());
-        uint64_t ip = BUFFER.front().ip;
-        uint64_t instr_id = BUFFER.front().instr_id;
-        BUFFER.pop_front();
-        return {ip, instr_id};
-    }
-    
-    void issue_prefetch(uint64_t instr_id, uint64_t event_cycle) {
-         inflight_mops[instr_id]= event_cycle;
+        uint64_t ip = ftq[ftq_head].ip;
+        ftq_head = (ftq_head + 1) % std::size(ftq);
+        --ftq_occupancy;
+        queued_blocks.erase(ip >> LOG2_BLOCK_SIZE);
+        return ip;
     }
 
-    void issue_instruction(uint64_t instr_id, uint64_t event_cycle){
-        if (inflight_mops.find(instr_id) != inflight_mops.end()){
-            uint64_t consumed_cycles = event_cycle - inflight_mops[instr_id];
-            mops ++;
-            cycles += consumed_cycles;
+    /*
+     * Drop the wrong-path blocks of a thread that are not yet prefetched,
+     * once the branch that led to them is resolved
+     */
+    void drop_wrong_path(uint8_t thread) {
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < ftq_occupancy; ++i) {
+            auto entry = ftq[(ftq_head + i) % std::size(ftq)];
+            if (entry.wrong_path && entry.thread == thread)
+                queued_blocks.erase(entry.ip >> LOG2_BLOCK_SIZE);
+            else
+                ftq[(ftq_head + kept++) % std::size(ftq)] = entry;
         }
+        ftq_occupancy = kept;
     }
 
-    void print_stats() {
-        double delay = 0.0;
-        if (mops > 0){
-            delay = (double) cycles / (double) mops;
-        }
-        std::cout << "[FDIP] Average delay: " << delay << std::endl;
+    // The core fetches instructions of a block, or sends them on to decode
+    void fetch_block(uint64_t ip, uint32_t count) {
+        fetched_blocks[ip >> LOG2_BLOCK_SIZE] += count;
     }
 
+    void release_block(uint64_t ip) {
+        auto found = fetched_blocks.find(ip >> LOG2_BLOCK_SIZE);
+        assert(found != fetched_blocks.end());
+        if (--found->second == 0)
+            fetched_blocks.erase(found);
+    }
+
+    bool isFetched(uint64_t ip) const { return fetched_blocks.count(ip >> LOG2_BLOCK_SIZE) > 0; }
 };
+
+#endif
@@ -0,0 +1,89 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOST_PROFILER_H
+#define HOST_PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace champsim
+{
+
+// Host wall-clock time and calls of one part of the simulator
+struct profile_counter {
+  std::string name;
+  std::size_t depth = 0; // when recorded, the number of counters it is nested within
+  uint64_t calls = 0;
+  std::chrono::steady_clock::duration time{};
+};
+
+struct host_profile {
+  std::vector<profile_counter> counters;
+  std::chrono::steady_clock::duration total{};
+  std::chrono::steady_clock::duration overhead{}; // of timing one call, which is included in the time of every counter
+};
+
+// Set by --profile_host. Otherwise, no counter is registered and no region is timed.
+extern bool host_profiling;
+
+// Counters are registered before the simulation begins and are never moved, so that a region may keep a pointer to its own.
+// A counter with a parent times a region within that of the parent, and is recorded after it.
+profile_counter* register_profile_counter(std::string name, const profile_counter* parent = nullptr);
+
+// Every counter is zeroed at the beginning of a phase, and recorded at its end
+void begin_host_profile_phase();
+void end_host_profile_phase();
+const std::vector<host_profile>& host_profile_phases();
+
+// Times a region for as long as it is in scope
+class profile_scope
+{
+  profile_counter* const counter;
+  std::chrono::steady_clock::time_point start;
+
+public:
+  explicit profile_scope(profile_counter* c) : counter(c)
+  {
+    if (counter != nullptr)
+      start = std::chrono::steady_clock::now();
+  }
+
+  ~profile_scope()
+  {
+    if (counter != nullptr) {
+      ++counter->calls;
+      counter->time += std::chrono::steady_clock::now() - start;
+    }
+  }
+
+  profile_scope(const profile_scope&) = delete;
+  profile_scope& operator=(const profile_scope&) = delete;
+};
+
+template <typename F>
+void profiled(profile_counter* counter, F&& func)
+{
+  profile_scope timer{counter};
+  std::forward<F>(func)();
+}
+
+} // namespace champsim
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef INLINE_VECTOR_H
+#define INLINE_VECTOR_H
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+
+namespace champsim
+{
+
+// A vector of at most N elements, which are held in place rather than on the heap, so that copying it does not allocate
+template <typename T, std::size_t N>
+class inline_vector
+{
+  std::array<T, N> values = {};
+  std::size_t count = 0;
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  inline_vector() = default;
+  inline_vector(std::initializer_list<T> init)
+  {
+    for (const auto& x : init)
+      push_back(x);
+  }
+
+  iterator begin() { return std::data(values); }
+  iterator end() { return std::data(values) + count; }
+  const_iterator begin() const { return std::data(values); }
+  const_iterator end() const { return std::data(values) + count; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  size_type size() const { return count; }
+  bool empty() const { return count == 0; }
+  static constexpr size_type capacity() { return N; }
+
+  pointer data() { return std::data(values); }
+  const_pointer data() const { return std::data(values); }
+
+  reference operator[](size_type i) { return values[i]; }
+  const_reference operator[](size_type i) const { return values[i]; }
+  reference front() { return values.front(); }
+  const_reference front() const { return values.front(); }
+  reference back() { return values[count - 1]; }
+  const_reference back() const { return values[count - 1]; }
+
+  void push_back(const T& value)
+  {
+    assert(count < N);
+    values[count++] = value;
+  }
+
+  void clear() { count = 0; }
+
+  iterator erase(const_iterator first, const_iterator last)
+  {
+    auto dest = begin() + (first - cbegin());
+    auto retval = std::move(begin() + (last - cbegin()), end(), dest);
+    count = static_cast<size_type>(retval - begin());
+    return dest;
+  }
+
+  iterator erase(const_iterator pos) { return erase(pos, std::next(pos)); }
+};
+
+} // namespace champsim
+
+#endif
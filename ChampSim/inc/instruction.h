@@ -20,11 +20,16 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <iostream>
 #include <limits>
+#include <utility>
 #include <vector>
 
+#include "inline_vector.hpp"
+#include "pool_allocator.hpp"
+#include "trace_format.h"
 #include "trace_instruction.h"
 
 // branch types
@@ -59,29 +64,50 @@ struct ooo_model_instr {
   uint8_t decoded = 0;
   uint8_t scheduled = 0;
   uint8_t executed = 0;
+  bool retired = false;
+
+  uint8_t thread = 0; // hardware thread of an SMT core
 
   unsigned completed_mem_ops = 0;
   int num_reg_dependent = 0;
 
-  std::vector<uint8_t> destination_registers = {}; // output registers
-  std::vector<uint8_t> source_registers = {};      // input registers
+  // Held in place, so that an instruction is built and copied without allocating
+  champsim::inline_vector<uint8_t, NUM_INSTR_DESTINATIONS_SPARC> destination_registers = {}; // output registers
+  champsim::inline_vector<uint8_t, NUM_INSTR_SOURCES> source_registers = {};                 // input registers
+
+  champsim::inline_vector<uint64_t, NUM_INSTR_DESTINATIONS_SPARC> destination_memory = {};
+  champsim::inline_vector<uint64_t, NUM_INSTR_SOURCES> source_memory = {};
+
+  // my physical destination registers, and those they replace, which are freed when I retire
+  champsim::inline_vector<uint32_t, NUM_INSTR_DESTINATIONS_SPARC> destination_phys_regs = {};
+  champsim::inline_vector<uint32_t, NUM_INSTR_DESTINATIONS_SPARC> replaced_phys_regs = {};
 
-  std::vector<uint64_t> destination_memory = {};
-  std::vector<uint64_t> source_memory = {};
+  // the first of the instructions in the ROB that depend on me, in the core's pool of dependences
+  uint32_t first_dependent = std::numeric_limits<uint32_t>::max();
 
-  // these are indices of instructions in the ROB that depend on me
-  std::vector<std::reference_wrapper<ooo_model_instr>> registers_instrs_depend_on_me;
+  // the LQ entries allocated for my loads
+  champsim::inline_vector<uint32_t, NUM_INSTR_SOURCES> lq_index = {};
 
-#ifdef _MULTIPLE_PAGE_SIZE
-  std::vector<uint64_t> base_vpn_destination = {};
-	std::vector<uint64_t> base_vpn_source = {};
+#if defined(MULTIPLE_PAGE_SIZE)
+  // Pages recorded by a packed trace, each that of the address in the same position. A page size of zero leaves it to the core.
+  uint8_t ip_page_size = 0;
+  uint64_t ip_base_vpn = 0;
 
-	std::vector<uint8_t> page_size_destination = {};
-	std::vector<uint8_t> page_size_source = {};
+  champsim::inline_vector<uint64_t, NUM_INSTR_DESTINATIONS_SPARC> base_vpn_destination = {};
+  champsim::inline_vector<uint64_t, NUM_INSTR_SOURCES> base_vpn_source = {};
 
-	// keep around a record of what the original virtual addresses were
-	//std::vector<uint64_t> destination_virtual_address = {};
-	//std::vector<uint64_t> source_virtual_address = {};
+  champsim::inline_vector<uint8_t, NUM_INSTR_DESTINATIONS_SPARC> page_size_destination = {};
+  champsim::inline_vector<uint8_t, NUM_INSTR_SOURCES> page_size_source = {};
+
+  std::pair<uint8_t, uint64_t> ip_page() const { return {ip_page_size, ip_base_vpn}; }
+  std::pair<uint8_t, uint64_t> destination_page(std::size_t i) const
+  {
+    return i < std::size(page_size_destination) ? std::pair{page_size_destination[i], base_vpn_destination[i]} : std::pair<uint8_t, uint64_t>{};
+  }
+  std::pair<uint8_t, uint64_t> source_page(std::size_t i) const
+  {
+    return i < std::size(page_size_source) ? std::pair{page_size_source[i], base_vpn_source[i]} : std::pair<uint8_t, uint64_t>{};
+  }
 #endif
 
 private:
@@ -160,7 +186,7 @@ private:
     	std::cout << std::hex << "0x" << (uint32_t)(src_mem) << std::dec << " ";
   	std::cout << std::endl;
 
-#if defined(_MULTIPLE_PAGE_SIZE)
+#if defined(MULTIPLE_PAGE_SIZE)
   	std::cout << "     source_page_size: ";
   	for (auto& src_pgsz : this->page_size_source)
     	std::cout << (uint32_t)(src_pgsz) << " ";
@@ -182,7 +208,7 @@ private:
     	std::cout << std::hex << "0x" << (uint32_t)(dest_mem) << std::dec << " ";
   	std::cout << std::endl;
 
-#if defined(_MULTIPLE_PAGE_SIZE)
+#if defined(MULTIPLE_PAGE_SIZE)
   	std::cout << "destination_page_size: ";
   	for (auto& dest_pgsz : this->page_size_destination)
     	std::cout << (uint32_t)(dest_pgsz) << " ";
@@ -198,35 +224,39 @@ private:
 	}
 public:
 
-#if defined(_MULTIPLE_PAGE_SIZE)
-	ooo_model_instr(uint8_t cpu, input_instr instr, page_size_info pgsz_info) : ooo_model_instr(instr, {cpu, cpu}) 
-{
-		// Why use back inserter??? 
-	std::remove_copy(std::begin(pgsz_info.base_vpn_destination), std::end(pgsz_info.base_vpn_destination), std::back_inserter(this->base_vpn_destination), 0);
-	std::remove_copy(std::begin(pgsz_info.page_size_destination), std::end(pgsz_info.page_size_destination), std::back_inserter(this->page_size_destination), 0);
-	std::remove_copy(std::begin(pgsz_info.base_vpn_source), std::end(pgsz_info.base_vpn_source), std::back_inserter(this->base_vpn_source), 0);
-	std::remove_copy(std::begin(pgsz_info.page_size_source), std::end(pgsz_info.page_size_source), std::back_inserter(this->page_size_source), 0);
-
-	//this->print_instr();
-}
-
-  ooo_model_instr(uint8_t, cloudsuite_instr instr, page_size_info pgsz_info) : ooo_model_instr(instr, {instr.asid[0], instr.asid[1]}) 
-{
-	std::remove_copy(std::begin(pgsz_info.base_vpn_destination), std::end(pgsz_info.base_vpn_destination), std::back_inserter(this->base_vpn_destination), 0);
-	std::remove_copy(std::begin(pgsz_info.page_size_destination), std::end(pgsz_info.page_size_destination), std::back_inserter(this->page_size_destination), 0);
-	std::remove_copy(std::begin(pgsz_info.base_vpn_source), std::end(pgsz_info.base_vpn_source), std::back_inserter(this->base_vpn_source), 0);
-	std::remove_copy(std::begin(pgsz_info.page_size_source), std::end(pgsz_info.page_size_source), std::back_inserter(this->page_size_source), 0);
-}
-
-#else
   ooo_model_instr(uint8_t cpu, input_instr instr) : ooo_model_instr(instr, {cpu, cpu}) {}
   ooo_model_instr(uint8_t, cloudsuite_instr instr) : ooo_model_instr(instr, {instr.asid[0], instr.asid[1]}) {}
+
+  ooo_model_instr(uint8_t cpu, const champsim::packed_instr& packed) : ooo_model_instr(packed.instr, {cpu, cpu})
+  {
+#if defined(MULTIPLE_PAGE_SIZE)
+    ip_page_size = packed.ip_page.size;
+    ip_base_vpn = packed.ip_page.base_vpn;
+    for (std::size_t i = 0; i < NUM_INSTR_DESTINATIONS; ++i) {
+      if (packed.instr.destination_memory[i] != 0) {
+        page_size_destination.push_back(packed.destination_pages[i].size);
+        base_vpn_destination.push_back(packed.destination_pages[i].base_vpn);
+      }
+    }
+    for (std::size_t i = 0; i < NUM_INSTR_SOURCES; ++i) {
+      if (packed.instr.source_memory[i] != 0) {
+        page_size_source.push_back(packed.source_pages[i].size);
+        base_vpn_source.push_back(packed.source_pages[i].base_vpn);
+      }
+    }
 #endif
+  }
 
   std::size_t num_mem_ops() const { return std::size(destination_memory) + std::size(source_memory); }
 
   static bool program_order(const ooo_model_instr& lhs, const ooo_model_instr& rhs) { return lhs.instr_id < rhs.instr_id; }
 
-
 };
+
+namespace champsim
+{
+// The queues between the stages of the pipeline, whose blocks are recycled as instructions pass through them
+using instr_queue = std::deque<ooo_model_instr, pool_allocator<ooo_model_instr>>;
+} // namespace champsim
+
 #endif
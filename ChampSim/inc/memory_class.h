@@ -23,6 +23,7 @@
 #include <limits>
 #include <vector>
 
+#include "champsim.h"
 #include "util.h"
 
 enum access_type {
@@ -79,6 +80,27 @@ public:
 
 };
 
+// An access performed at once, outside of the timing model, for functional warmup.
+// It carries only what the tags and the replacement state are updated from.
+struct functional_request {
+  uint8_t type = LOAD;
+  uint32_t cpu = std::numeric_limits<uint32_t>::max();
+
+  uint64_t address = 0, v_address = 0, data = 0, instr_id = 0, ip = 0;
+
+  std::size_t translation_level = 0;
+
+#if defined(MULTIPLE_PAGE_SIZE)
+  uint32_t page_size = 0;
+  uint64_t base_vpn = 0;
+#endif
+
+#if defined ENABLE_EXTRA_CACHE_STATS || defined FORCE_HIT || defined FORCE_PTE_HIT
+  bool is_instr = false;
+  bool is_pte = false;
+#endif
+};
+
 template <>
 struct is_valid<PACKET> {
   bool operator()(const PACKET& test) { return test.address != 0; }
@@ -94,6 +116,9 @@ public:
   virtual std::size_t get_occupancy(uint8_t queue_type, uint64_t address) = 0;
   virtual std::size_t get_size(uint8_t queue_type, uint64_t address) = 0;
 
+  // Perform the access at once, outside of the timing model, and return the data read. Used for functional warmup.
+  virtual uint64_t functional_access(const functional_request& request) = 0;
+
   explicit MemoryRequestConsumer() {}
 };
 
@@ -126,6 +126,15 @@ public:
     return std::exchange(*hit, {}).data;
   }
 
+  template <typename Archive>
+  void serialize(Archive& ar)
+  {
+    ar.expect(NUM_SET);
+    ar.expect(NUM_WAY);
+    ar.io(access_count);
+    ar.io(block);
+  }
+
   lru_table(std::size_t sets, std::size_t ways, SetProj set_proj, TagProj tag_proj)
       : set_projection(set_proj), tag_projection(tag_proj), NUM_SET(sets), NUM_WAY(ways)
   {
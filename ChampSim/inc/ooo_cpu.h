@@ -19,6 +19,7 @@
 
 #include <array>
 #include <bitset>
+#include <cassert>
 #include <deque>
 #include <functional>
 #include <limits>
@@ -26,24 +27,36 @@
 #include <queue>
 #include <vector>
 #include <map>
+#include <memory>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <unordered_map>
 
 #include "champsim.h"
+#include "checkpoint.h"
 #include "champsim_constants.h"
 #include "instruction.h"
 #include "memory_class.h"
 #include "operable.h"
+#include "page_size_oracle.h"
 #include "util.h"
 
 #if defined(ENABLE_FDIP)
 #include "fdip.h"
 #endif
+#if defined TRACK_BRANCH_HISTORY
+#include "history_tracker.h"
+#endif
 
 
 enum STATUS { INFLIGHT = 1, COMPLETED = 2 };
 
+// The hardware threads of an SMT core. Each thread beyond the first runs in an address space of its own,
+// told apart by its index in the bits of the virtual address above SMT_ASID_SHIFT.
+constexpr std::size_t MAX_SMT_THREADS = 8;
+constexpr unsigned SMT_ASID_SHIFT = 56;
+
 class CacheBus : public MemoryRequestProducer
 {
   uint32_t cpu;
@@ -53,6 +66,8 @@ public:
   CacheBus(uint32_t cpu_idx, MemoryRequestConsumer* ll) : MemoryRequestProducer(ll), cpu(cpu_idx) {}
   bool issue_read(PACKET packet);
   bool issue_write(PACKET packet);
+  void functional_read(functional_request request);
+  void functional_write(functional_request request);
   void return_data(const PACKET& packet) override final;
 };
 
@@ -65,8 +80,13 @@ struct cpu_stats {
   std::array<long long, 8> total_branch_types = {};
   std::array<long long, 8> branch_type_misses = {};
 
+  // of each hardware thread, if there is more than one
+  std::vector<uint64_t> begin_thread_instrs{}, end_thread_instrs{};
+  std::vector<long long> thread_branch_misses{};
+
   uint64_t instrs() const { return end_instrs - begin_instrs; }
   uint64_t cycles() const { return end_cycles - begin_cycles; }
+  uint64_t thread_instrs(std::size_t thread) const { return end_thread_instrs.at(thread) - begin_thread_instrs.at(thread); }
 	
 #if defined(MULTIPLE_PAGE_SIZE)
 	uint64_t total_instr_large_pages = 0;
@@ -95,6 +115,8 @@ struct LSQ_ENTRY {
 #endif
 
   bool fetch_issued = false;
+  bool committed = false;
+  uint8_t thread = 0;
 
   uint64_t producer_id = std::numeric_limits<uint64_t>::max();
   std::vector<std::reference_wrapper<std::optional<LSQ_ENTRY>>> lq_depend_on_me{};
@@ -103,7 +125,7 @@ struct LSQ_ENTRY {
 #else
   LSQ_ENTRY(uint64_t id, uint64_t addr, uint64_t ip, std::array<uint8_t, 2> asid);
 #endif
-  void finish(std::deque<ooo_model_instr>::iterator begin, std::deque<ooo_model_instr>::iterator end) const;
+  ooo_model_instr& finish(champsim::instr_queue::iterator begin, champsim::instr_queue::iterator end) const;
 };
 
 // cpu
@@ -139,15 +161,22 @@ public:
   dib_type DIB;
 
   // reorder buffer, load/store queue, register file
-  std::deque<ooo_model_instr> IFETCH_BUFFER;
-  std::deque<ooo_model_instr> DISPATCH_BUFFER;
-  std::deque<ooo_model_instr> DECODE_BUFFER;
-  std::deque<ooo_model_instr> ROB;
+  champsim::instr_queue IFETCH_BUFFER;
+  champsim::instr_queue DISPATCH_BUFFER;
+  champsim::instr_queue DECODE_BUFFER;
+  champsim::instr_queue ROB;
 
   std::vector<std::optional<LSQ_ENTRY>> LQ;
   std::deque<LSQ_ENTRY> SQ;
 
-  std::array<std::vector<std::reference_wrapper<ooo_model_instr>>, std::numeric_limits<uint8_t>::max() + 1> reg_producers;
+  // Indices into the LSQ, so that dispatch, forwarding and memory returns need not search it
+  struct sq_address_entry {
+    std::size_t count = 0;
+    uint64_t youngest_id = 0;
+  };
+  std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> lq_free; // free LQ slots, lowest first
+  std::unordered_map<uint64_t, sq_address_entry> sq_by_address;                         // the stores to each address
+  std::unordered_map<uint64_t, std::vector<uint32_t>> lq_by_block;                      // issued loads, by the block they wait on
 
   // Constants
   const std::size_t IFETCH_BUFFER_SIZE, DISPATCH_BUFFER_SIZE, DECODE_BUFFER_SIZE, ROB_SIZE, SQ_SIZE;
@@ -157,11 +186,67 @@ public:
   const unsigned BRANCH_MISPREDICT_PENALTY, DISPATCH_LATENCY, DECODE_LATENCY, SCHEDULING_LATENCY, EXEC_LATENCY;
   const long int L1I_BANDWIDTH, L1D_BANDWIDTH;
 
-  // branch
-  uint64_t fetch_resume_cycle = 0;
+  const bool SMT_PARTITIONED;
+
+  // the block most recently fetched by functional_execute()
+  uint64_t functional_fetch_block = std::numeric_limits<uint64_t>::max();
+
+  const long IN_QUEUE_SIZE; // instructions read ahead from each trace, enough for fetch, or for a decoupled branch prediction unit to run ahead
+
+  static constexpr uint32_t NO_PHYS_REG = std::numeric_limits<uint32_t>::max();
+  static constexpr uint32_t NO_DEPENDENT = std::numeric_limits<uint32_t>::max();
+
+  // The state that each hardware thread keeps apart. The pipeline buffers, ROB, LQ and SQ are shared, or partitioned equally if SMT_PARTITIONED.
+  struct hw_thread {
+    champsim::instr_queue input_queue;
+    uint64_t fetch_resume_cycle = 0;
+    std::array<uint32_t, std::numeric_limits<uint8_t>::max() + 1> rename_table; // the physical register of the last writer of each register
 
-  const long IN_QUEUE_SIZE = 2 * FETCH_WIDTH;
-  std::deque<ooo_model_instr> input_queue;
+    hw_thread() { rename_table.fill(NO_PHYS_REG); }
+
+    std::size_t icount = 0; // instructions fetched and not yet executed, by which fetch is arbitrated
+
+    // A decoupled branch prediction unit predicts the instructions at the front of the input queue before they are fetched.
+    // After a mispredicted branch, it queues blocks along the predicted path until the branch is resolved.
+    std::size_t predicted = 0;
+    bool wrong_path = false;
+    uint64_t wrong_path_ip = 0;
+    std::size_t wrong_path_blocks = 0; // left to queue down the wrong path
+
+    std::size_t rob_occupancy = 0;
+    std::size_t lq_occupancy = 0;
+    std::size_t sq_occupancy = 0;
+    uint64_t num_retired = 0;
+  };
+  std::vector<hw_thread> threads;
+  std::size_t last_fetch_thread = 0;
+  uint64_t next_fetch_id = 1; // instructions are numbered again as they are fetched, in the order of the shared pipeline
+
+  // Wakeup and select. Instructions wait in a wakeup queue until their event cycle, then in a ready queue from which the oldest are selected.
+  // Entries point into the ROB, which only frees instructions that have passed through both stages.
+  struct later_event {
+    bool operator()(const ooo_model_instr* lhs, const ooo_model_instr* rhs) const { return lhs->event_cycle > rhs->event_cycle; }
+  };
+  struct younger {
+    bool operator()(const ooo_model_instr* lhs, const ooo_model_instr* rhs) const { return lhs->instr_id > rhs->instr_id; }
+  };
+  using wakeup_queue = std::priority_queue<ooo_model_instr*, std::vector<ooo_model_instr*>, later_event>;
+  using ready_queue = std::priority_queue<ooo_model_instr*, std::vector<ooo_model_instr*>, younger>;
+  wakeup_queue execute_wakeup, complete_wakeup; // waiting for operands, or for execution to finish
+  ready_queue execute_ready, complete_ready;
+  std::size_t num_scheduled = 0;       // the length of the scheduled prefix of the ROB
+  std::size_t scheduler_occupancy = 0; // scheduled instructions that have not yet executed
+
+  // Register renaming. Each destination is given a physical register as it is scheduled, which is freed when the next writer of its register retires.
+  // An instruction waits on the producers of its sources, through links taken from a pool that holds as many as the ROB can need.
+  struct dependence {
+    ooo_model_instr* consumer;
+    uint32_t next;
+  };
+  std::vector<ooo_model_instr*> phys_reg_producer; // the instruction that will write each physical register, or nullptr once it is written
+  std::vector<uint32_t> phys_reg_free;
+  std::vector<dependence> dependence_pool;
+  std::vector<uint32_t> dependence_free;
 
   CacheBus L1I_bus, L1D_bus;
 
@@ -169,31 +254,52 @@ public:
 #if defined(MULTIPLE_PAGE_SIZE)
 	uint64_t INSTR_PAGE_SIZE_DIST = 0;
 	std::string INSTR_PAGE_DIST_FILENAME;
-	std::map<uint64_t, uint8_t> code_page_sizes;
+	champsim::page_size_oracle code_page_sizes;
 
 	uint64_t DATA_PAGE_SIZE_DIST = 0;
 	std::string DATA_PAGE_DIST_FILENAME;
-	std::map<uint64_t, uint8_t> data_page_sizes;
+	champsim::page_size_oracle data_page_sizes;
+
+	// from PAGE_SIZE_MAP_FILENAME, in place of the two distributions above
+	std::shared_ptr<champsim::page_size_map> page_map;
 
 #endif
 
 #if defined(ENABLE_FDIP)
-	//FDIP fdip = FDIP(0);
-	FDIP fdip = FDIP(16);
+	FDIP fdip;
 #endif
 
-/*
-#if defined TRACK_BRANCH_HISTORY 
-	historyTracker *histTracker;
-#endif	
-*/
+  // Host time of each stage, registered within that of the core if the host is profiled
+  struct stage_profile_type {
+    champsim::profile_counter *retire_rob = nullptr, *complete_inflight_instruction = nullptr, *execute_instruction = nullptr,
+                              *schedule_instruction = nullptr, *handle_memory_return = nullptr, *operate_lsq = nullptr, *dispatch_instruction = nullptr,
+                              *decode_instruction = nullptr, *promote_to_decode = nullptr, *fetch_instruction = nullptr, *check_dib = nullptr,
+                              *initialize_instruction = nullptr, *fdip_prefetch = nullptr;
+  } stage_profile;
+
+#if defined TRACK_BRANCH_HISTORY
+  champsim::branch_history branch_history;
+#endif
   void initialize() override final;
 	void finalize();
   void operate() override final;
   void begin_phase() override final;
   void end_phase(unsigned cpu) override final;
+  uint64_t next_event_cycle() const override final;
 
   void initialize_instruction();
+  std::size_t select_fetch_thread() const;
+  std::size_t fetchable(const hw_thread& thread) const;
+  bool decoupled_bpu() const;
+#if defined(ENABLE_FDIP)
+  void predict_ahead();
+  bool can_predict_ahead(const hw_thread& thread) const;
+#endif
+  void begin_wrong_path(const ooo_model_instr& branch, uint64_t predicted_target);
+  void resolve_branch(uint8_t thread);
+  std::size_t rob_occupancy() const;
+  bool can_dispatch(const ooo_model_instr& instr) const;
+  std::array<uint64_t, MAX_SMT_THREADS> oldest_unretired() const;
   void check_dib();
   void translate_fetch();
   void fetch_instruction();
@@ -208,45 +314,93 @@ public:
   void handle_memory_return();
   void retire_rob();
 
-  bool do_init_instruction(ooo_model_instr& instr);
-  bool do_predict_branch(ooo_model_instr& instr);
+  bool do_init_instruction(ooo_model_instr& instr, bool functional = false);
+  bool do_predict_branch(ooo_model_instr& instr, bool functional = false);
   void do_check_dib(ooo_model_instr& instr);
-  bool do_fetch_instruction(std::deque<ooo_model_instr>::iterator begin, std::deque<ooo_model_instr>::iterator end);
+  bool do_fetch_instruction(champsim::instr_queue::iterator begin, champsim::instr_queue::iterator end);
   void do_dib_update(const ooo_model_instr& instr);
+  bool can_rename(const ooo_model_instr& instr) const;
   void do_scheduling(ooo_model_instr& instr);
   void do_execution(ooo_model_instr& rob_it);
   void do_memory_scheduling(ooo_model_instr& instr);
   void do_complete_execution(ooo_model_instr& instr);
   void do_sq_forward_to_lq(LSQ_ENTRY& sq_entry, LSQ_ENTRY& lq_entry);
 
+  std::optional<LSQ_ENTRY>& allocate_lq(uint8_t thread);
+  void release_lq(std::optional<LSQ_ENTRY>& lq_entry);
+  void allocate_sq(uint8_t thread, LSQ_ENTRY&& sq_entry);
+  void release_sq(LSQ_ENTRY& sq_entry);
+
+  void wake_up(wakeup_queue& waiting, ready_queue& ready);
+  void do_finish_mem_op(const LSQ_ENTRY& lsq_entry);
   void do_finish_store(const LSQ_ENTRY& sq_entry);
   bool do_complete_store(const LSQ_ENTRY& sq_entry);
   bool execute_load(const LSQ_ENTRY& lq_entry);
 
+  // Marks an instruction read from the trace of the given thread, and moves its addresses into the thread's address space
+  void assign_thread(ooo_model_instr& instr, uint8_t thread) const;
+
+  // Forget what a decoupled branch prediction unit has predicted, when the input queues are taken away
+  void flush_prediction();
+
+  // Retire an instruction at once, warming the predictors, TLBs and caches that it touches without modeling the pipeline
+  void functional_execute(ooo_model_instr arch_instr);
+
+#if defined(MULTIPLE_PAGE_SIZE)
+  // The page of an instruction or data address, as chosen by the oracle of its stream
+  std::pair<uint8_t, uint64_t> lookup_page_size(bool is_instr, uint64_t addr, std::pair<uint8_t, uint64_t> traced_page = {})
+  {
+    return (is_instr ? code_page_sizes : data_page_sizes).lookup(addr, traced_page);
+  }
+#endif
+
   uint64_t roi_instr() const { return roi_stats.back().instrs(); }
   uint64_t roi_cycle() const { return roi_stats.back().cycles(); }
   uint64_t sim_instr() const { return num_retired - begin_phase_instr; }
   uint64_t sim_cycle() const { return current_cycle - sim_stats.back().begin_cycles; }
 
   void print_deadlock() override final;
+  void serialize(champsim::checkpoint_archive& ar);
 
 #include "ooo_cpu_modules.inc"
 
   const std::bitset<NUM_BRANCH_MODULES> bpred_type;
   const std::bitset<NUM_BTB_MODULES> btb_type;
 
-  O3_CPU(uint32_t index, double freq_scale, dib_type&& dib, std::size_t ifetch_buffer_size, std::size_t decode_buffer_size, std::size_t dispatch_buffer_size,
+  O3_CPU(uint32_t index, champsim::clock_ratio freq_scale, dib_type&& dib, std::size_t ifetch_buffer_size, std::size_t decode_buffer_size, std::size_t dispatch_buffer_size,
          std::size_t rob_size, std::size_t lq_size, std::size_t sq_size, unsigned fetch_width, unsigned decode_width, unsigned dispatch_width,
          unsigned schedule_width, unsigned execute_width, long int lq_width, long int sq_width, unsigned retire_width, unsigned mispredict_penalty,
          unsigned decode_latency, unsigned dispatch_latency, unsigned schedule_latency, unsigned execute_latency, MemoryRequestConsumer* l1i, long int l1i_bw,
-         MemoryRequestConsumer* l1d, long int l1d_bw, std::bitset<NUM_BRANCH_MODULES> bpred, std::bitset<NUM_BTB_MODULES> btb)
+         MemoryRequestConsumer* l1d, long int l1d_bw, std::bitset<NUM_BRANCH_MODULES> bpred, std::bitset<NUM_BTB_MODULES> btb,
+         std::size_t smt_threads = 1, bool smt_partitioned = true, std::size_t physical_registers = 0, [[maybe_unused]] uint32_t fdip_aggressiveness = 16,
+         std::size_t fdip_run_ahead = 64, [[maybe_unused]] std::size_t fdip_ftq_size = 64, bool fdip_decoupled = false,
+         [[maybe_unused]] std::size_t fdip_wrong_path_blocks = 4)
       : champsim::operable(freq_scale), cpu(index), DIB{std::move(dib)}, LQ(lq_size), IFETCH_BUFFER_SIZE(ifetch_buffer_size),
         DISPATCH_BUFFER_SIZE(dispatch_buffer_size), DECODE_BUFFER_SIZE(decode_buffer_size), ROB_SIZE(rob_size), SQ_SIZE(sq_size), FETCH_WIDTH(fetch_width),
         DECODE_WIDTH(decode_width), DISPATCH_WIDTH(dispatch_width), SCHEDULER_SIZE(schedule_width), EXEC_WIDTH(execute_width), LQ_WIDTH(lq_width),
         SQ_WIDTH(sq_width), RETIRE_WIDTH(retire_width), BRANCH_MISPREDICT_PENALTY(mispredict_penalty), DISPATCH_LATENCY(dispatch_latency),
         DECODE_LATENCY(decode_latency), SCHEDULING_LATENCY(schedule_latency), EXEC_LATENCY(execute_latency), L1I_BANDWIDTH(l1i_bw), L1D_BANDWIDTH(l1d_bw),
-        L1I_bus(cpu, l1i), L1D_bus(cpu, l1d), bpred_type(bpred), btb_type(btb)
+        SMT_PARTITIONED(smt_partitioned),
+        IN_QUEUE_SIZE(fdip_decoupled ? std::max<long>(2 * fetch_width, static_cast<long>(fdip_run_ahead)) : 2 * fetch_width), threads(smt_threads), L1I_bus(cpu, l1i), L1D_bus(cpu, l1d),
+#if defined(ENABLE_FDIP)
+        fdip(fdip_aggressiveness, fdip_run_ahead, fdip_ftq_size, fdip_decoupled, fdip_wrong_path_blocks),
+#endif
+        bpred_type(bpred), btb_type(btb)
   {
+    assert(smt_threads > 0 && smt_threads <= MAX_SMT_THREADS);
+    for (uint32_t i = 0; i < lq_size; ++i)
+      lq_free.push(i);
+
+    // Unless limited, there are enough physical registers for every register of every thread and every destination in the ROB
+    if (physical_registers == 0)
+      physical_registers = smt_threads * (std::numeric_limits<uint8_t>::max() + 1) + rob_size * NUM_INSTR_DESTINATIONS_SPARC;
+    assert(physical_registers >= NUM_INSTR_DESTINATIONS_SPARC);
+    phys_reg_producer.resize(physical_registers);
+    for (auto i = static_cast<uint32_t>(physical_registers); i > 0; --i)
+      phys_reg_free.push_back(i - 1);
+    dependence_pool.resize(rob_size * NUM_INSTR_SOURCES);
+    for (auto i = static_cast<uint32_t>(std::size(dependence_pool)); i > 0; --i)
+      dependence_free.push_back(i - 1);
   }
 };
 
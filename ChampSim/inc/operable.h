@@ -17,36 +17,46 @@
 #ifndef OPERABLE_H
 #define OPERABLE_H
 
+#include <cstdint>
 #include <iostream>
 
+#include "host_profiler.h"
+
 namespace champsim
 {
 
+// The number of cycles of the fastest clock that elapse for every given number of cycles of a component's clock
+struct clock_ratio {
+  uint64_t base_cycles = 1;
+  uint64_t own_cycles = 1;
+};
+
 class operable
 {
 public:
-  const double CLOCK_SCALE;
+  const clock_ratio CLOCK_SCALE;
 
-  double leap_operation = 0;
   uint64_t current_cycle = 0;
   bool warmup = true;
+  profile_counter* profile = nullptr; // times operate(), if the host is profiled
 
-  explicit operable(double scale) : CLOCK_SCALE(scale - 1) {}
+  explicit operable(clock_ratio scale) : CLOCK_SCALE(scale) {}
 
   void _operate()
   {
-    // skip periodically
-    if (leap_operation >= 1) {
-      leap_operation -= 1;
-      return;
-    }
-
+    profile_scope timer{profile};
     operate();
-
-    leap_operation += CLOCK_SCALE;
     ++current_cycle;
   }
 
+  // Advance the clock exactly as _operate() would, but without operating.
+  // Only valid when operate() is known to have nothing to do this cycle.
+  void _idle() { ++current_cycle; }
+
+  // The earliest cycle at which operate() may change any state, assuming no other component acts first.
+  // Components that cannot bound this report the current cycle, which means they are never skipped.
+  virtual uint64_t next_event_cycle() const { return current_cycle; }
+
   virtual void initialize(){};
   virtual void operate() = 0;
   virtual void begin_phase(){};
@@ -54,12 +64,6 @@ public:
   virtual void print_deadlock() {}
 };
 
-class by_next_operate
-{
-public:
-  bool operator()(const operable& lhs, const operable& rhs) const { return lhs.leap_operation < rhs.leap_operation; }
-};
-
 } // namespace champsim
 
 #endif
@@ -0,0 +1,68 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef PAGE_MAP_H
+#define PAGE_MAP_H
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace champsim
+{
+
+/*
+ * A page-size map gives the size of every page of a trace in advance, so that the simulator need not choose them at random as the
+ * trace is read. tracer/page_analyzer writes one from a pass over the trace. It lists the 2 MB regions that are mapped by large pages,
+ * first those of code and then those of data, each list sorted and given by region number (the address shifted right by
+ * LARGE_PAGE_BITS). Every other page is a 4 KB page. The file is
+ *   magic       PAGE_MAP_MAGIC and a version byte
+ *   counts      uint64_t each: the number of code regions and then of data regions
+ *   regions     uint64_t each, in the order above
+ * in host byte order, which is how it is mapped into memory.
+ */
+constexpr std::array<char, 7> PAGE_MAP_MAGIC = {'C', 'S', 'P', 'G', 'M', 'A', 'P'};
+constexpr uint8_t PAGE_MAP_VERSION = 1;
+
+void write_page_size_map(std::ostream& out, const std::vector<uint64_t>& code_regions, const std::vector<uint64_t>& data_regions);
+
+class page_size_map
+{
+  void* mapping = nullptr;
+  std::size_t mapping_size = 0;
+  const uint64_t* code_begin = nullptr;
+  const uint64_t* code_end = nullptr;
+  const uint64_t* data_begin = nullptr;
+  const uint64_t* data_end = nullptr;
+
+public:
+  explicit page_size_map(const std::string& fname);
+  ~page_size_map();
+  page_size_map(const page_size_map&) = delete;
+  page_size_map& operator=(const page_size_map&) = delete;
+
+  bool is_large_code(uint64_t addr) const;
+  bool is_large_data(uint64_t addr) const;
+  std::size_t num_code_regions() const { return static_cast<std::size_t>(code_end - code_begin); }
+  std::size_t num_data_regions() const { return static_cast<std::size_t>(data_end - data_begin); }
+};
+
+} // namespace champsim
+
+#endif
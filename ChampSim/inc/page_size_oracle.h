@@ -0,0 +1,138 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PAGE_SIZE_ORACLE_H
+#define PAGE_SIZE_ORACLE_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "checkpoint.h"
+#include "page_map.h"
+#include "trace_format.h"
+
+namespace champsim
+{
+
+/*
+ * The page sizes that the simulator chose for a trace, which are saved at the end of a run (to INSTR_PAGE_DIST_FILENAME and
+ * DATA_PAGE_DIST_FILENAME) so that the next run of the trace chooses the same. A table file is
+ *   magic       PAGE_TABLE_MAGIC and a version byte
+ *   count       uint64_t: the number of pages
+ *   pages       uint64_t each: the page numbers, sorted
+ *   sizes       uint8_t each: the size of the page in the same position, which tells whether its number is of a 4 KB or a 2 MB page
+ * in host byte order. The file is mapped into memory and searched in place, and the pages first touched in a run are held in a hash
+ * table over it until the table is saved. Files of the earlier text format, a "page:size" line for each page, are read as well.
+ */
+constexpr std::array<char, 7> PAGE_TABLE_MAGIC = {'C', 'S', 'P', 'D', 'I', 'S', 'T'};
+constexpr uint8_t PAGE_TABLE_VERSION = 1;
+
+class page_size_table
+{
+  void* mapping = nullptr;
+  std::size_t mapping_size = 0;
+  const uint64_t* pages = nullptr;
+  const uint8_t* sizes = nullptr;
+  std::size_t num_mapped = 0;
+  bool modified = false;
+
+  // The pages added over the mapped ones, by open addressing with linear probing. A slot of size zero is empty.
+  struct slot {
+    uint64_t page = 0;
+    uint8_t size = 0;
+  };
+  std::vector<slot> added;
+  std::size_t num_added = 0;
+
+  std::size_t slot_index(uint64_t page) const; // of the page, or of the empty slot where it would go
+  void add(uint64_t page, uint8_t size);
+  void unmap();
+  void load_text(const std::string& fname);
+  std::optional<uint8_t> find_mapped(uint64_t page) const;
+
+public:
+  page_size_table() = default;
+  ~page_size_table() { unmap(); }
+  page_size_table(const page_size_table&) = delete;
+  page_size_table& operator=(const page_size_table&) = delete;
+
+  // Returns false if there is no such file, which leaves the table empty
+  bool load(const std::string& fname);
+
+  // Writes the table if it differs from the file that was loaded, in place of that file
+  void save(const std::string& fname);
+
+  std::optional<uint8_t> find(uint64_t page) const;
+  void assign(uint64_t page, uint8_t size);
+  void insert(uint64_t page, uint8_t size);
+
+  // Every page and its size, sorted by page
+  std::vector<std::pair<uint64_t, uint8_t>> entries() const;
+
+  // Held as a std::map of the same pages would be
+  void serialize(checkpoint_archive& ar);
+};
+
+/*
+ * Decides the size of the page that holds each address of one stream of a core, its instructions or its data, for the fetch, the
+ * load/store queues and the functional warmup alike. A page given by the trace is taken as it is. Otherwise, the page is that of the
+ * page size map if there is one, or else that which the table holds, or else a new one that is large with the given probability. The
+ * random choices are drawn from a generator of the oracle's own, so that a run is reproduced by the same seed.
+ */
+class page_size_oracle
+{
+public:
+  using page_type = std::pair<uint8_t, uint64_t>; // the page size and base VPN
+
+private:
+  page_size_table table;
+  std::shared_ptr<const page_size_map> map;
+  bool is_instr = false;
+  uint64_t large_page_dist = 0;
+  uint64_t rng_state = 0;
+
+  // The 4 KB page last looked up and its page, which stand until the table changes
+  uint64_t last_page = std::numeric_limits<uint64_t>::max();
+  page_type last_result;
+
+  page_type find_or_choose(uint64_t addr, page_type traced_page);
+
+public:
+  void seed(uint64_t seed, uint64_t stream);
+  void set_large_page_dist(uint64_t percent) { large_page_dist = percent; }
+  void use_map(std::shared_ptr<const page_size_map> page_map, bool instr);
+
+  page_type lookup(uint64_t addr, page_type traced_page = {})
+  {
+    if (traced_page.first == 0 && (addr >> SMALL_PAGE_BITS) == last_page)
+      return last_result;
+    return find_or_choose(addr, traced_page);
+  }
+
+  bool load(const std::string& fname) { return table.load(fname); }
+  void save(const std::string& fname) { table.save(fname); }
+  std::vector<std::pair<uint64_t, uint8_t>> entries() const { return table.entries(); }
+  void serialize(checkpoint_archive& ar);
+};
+} // namespace champsim
+
+#endif
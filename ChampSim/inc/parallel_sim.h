@@ -0,0 +1,161 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PARALLEL_SIM_H
+#define PARALLEL_SIM_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "clock_schedule.h"
+#include "memory_class.h"
+#include "operable.h"
+
+class O3_CPU;
+
+namespace champsim
+{
+
+struct parallel_config {
+  uint64_t quantum = 0; // cycles between synchronizations with the shared hierarchy; 0 runs serially
+  uint64_t slack = 0;   // quanta a core may run ahead of the shared hierarchy; 0 is deterministic
+};
+
+/*
+ * Stands in for a shared component (LLC, DRAM) as seen by one core's private hierarchy.
+ * Requests are posted by the core's thread and handed to the shared component at the next
+ * quantum boundary. Responses travel the other way in the same fashion.
+ */
+class quantum_channel : public MemoryRequestConsumer, public MemoryRequestProducer
+{
+  static constexpr std::size_t NUM_QUEUE_TYPES = 5;
+
+  struct request {
+    uint64_t quantum;
+    uint8_t queue_type;
+    PACKET packet;
+  };
+
+  struct response {
+    uint64_t quantum;
+    PACKET packet;
+  };
+
+  struct pending_return {
+    uint64_t address;
+    std::vector<MemoryRequestProducer*> to_return;
+  };
+
+  MemoryRequestProducer& upper;
+
+  // Touched by both threads
+  std::mutex request_mutex, response_mutex;
+  std::deque<request> requests;
+  std::deque<response> responses;
+  std::array<std::array<std::atomic<std::size_t>, NUM_QUEUE_TYPES>, 2> published_occupancy;
+
+  // Core side
+  uint64_t worker_quantum = 0;
+  std::deque<pending_return> pending_returns;
+  std::array<std::size_t, NUM_QUEUE_TYPES> capacity{}, occupancy{}, issued_prev{}, issued_cur{};
+
+  // Shared side
+  uint64_t shared_quantum = 0;
+  std::deque<request> backlog;
+
+  bool add(uint8_t queue_type, const PACKET& packet);
+
+public:
+  explicit quantum_channel(MemoryRequestProducer& producer);
+  ~quantum_channel();
+
+  quantum_channel(const quantum_channel&) = delete;
+  quantum_channel& operator=(const quantum_channel&) = delete;
+
+  // Called from the core's thread
+  bool add_rq(const PACKET& packet) override { return add(1, packet); }
+  bool add_wq(const PACKET& packet) override { return add(2, packet); }
+  bool add_pq(const PACKET& packet) override { return add(3, packet); }
+  bool add_ptwq(const PACKET& packet) override { return add(4, packet); }
+  std::size_t get_occupancy(uint8_t queue_type, uint64_t address) override;
+  std::size_t get_size(uint8_t queue_type, uint64_t address) override;
+  void begin_worker_quantum(uint64_t quantum);
+
+  // Functional warmup runs on the main thread, so it passes straight through
+  uint64_t functional_access(const functional_request& req) override { return lower_level->functional_access(req); }
+
+  // Called from the shared thread
+  void return_data(const PACKET& packet) override;
+  void begin_shared_quantum(uint64_t quantum);
+  void end_shared_quantum(uint64_t quantum);
+  void issue();
+};
+
+/*
+ * Runs each core, together with the components only it can reach, on its own thread.
+ * Components reached by more than one core are simulated on the calling thread.
+ */
+class parallel_engine
+{
+  struct core_group {
+    O3_CPU& cpu;
+    std::vector<std::reference_wrapper<operable>> operables;
+    std::optional<clock_schedule> schedule;
+    std::vector<quantum_channel*> channels;
+    std::vector<bool> phase_applied;
+    std::atomic<uint64_t> next_quantum = 0;
+    std::atomic<uint64_t> finish_quantum = std::numeric_limits<uint64_t>::max();
+
+    explicit core_group(O3_CPU& c) : cpu(c) {}
+  };
+
+  const parallel_config config;
+  std::vector<std::unique_ptr<core_group>> groups;
+  std::vector<std::reference_wrapper<operable>> shared_operables;
+  std::optional<clock_schedule> shared_schedule;
+  std::vector<std::unique_ptr<quantum_channel>> channels;
+  std::vector<bool> shared_phase_applied;
+
+  std::atomic<uint64_t> shared_next_quantum = 0;
+  std::atomic<uint64_t> stop_quantum = std::numeric_limits<uint64_t>::max();
+  uint64_t first_quantum = 0;
+
+  void run_core(core_group& group, uint64_t length, const std::string& phase_name, const std::function<void(O3_CPU&)>& refill);
+  void run_shared();
+  template <typename F>
+  void apply_finished(std::vector<bool>& applied, uint64_t before_quantum, F&& end_phase);
+
+public:
+  parallel_engine(std::vector<std::reference_wrapper<O3_CPU>>& cpus, std::vector<std::reference_wrapper<operable>>& operables, parallel_config cfg);
+
+  // False if the hierarchy could not be partitioned between cores
+  bool valid() const;
+
+  void run_phase(const std::string& phase_name, uint64_t length, const std::function<void(O3_CPU&)>& refill);
+};
+
+} // namespace champsim
+
+#endif
@@ -32,6 +32,8 @@ struct phase_info {
   bool is_warmup;
   uint64_t length;
   std::vector<std::string> trace_names;
+  bool is_functional = false; // retire instructions without timing, only to warm up the simulator state
+  bool is_timed = false;      // a warmup phase that models latencies as a simulation phase does, although its statistics are not reported
 };
 
 } // namespace champsim
@@ -0,0 +1,115 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace champsim
+{
+
+/*
+ * An allocator that keeps the blocks it frees for the next allocation of the same size, rather than returning them to the heap.
+ * A container that allocates blocks of one size, such as the nodes of a std::deque, then stops allocating once it has reached
+ * its largest size. Each thread keeps its own blocks, so the containers of one core do not contend with those of another.
+ */
+template <typename T>
+class pool_allocator
+{
+  struct pool {
+    std::size_t block_size = 0; // in elements; the first size allocated is the one that is recycled
+    std::vector<void*> blocks;
+
+    ~pool()
+    {
+      for (auto block : blocks)
+        ::operator delete(block);
+      retired() = true;
+    }
+  };
+
+  static pool& local_pool()
+  {
+    thread_local pool retval;
+    return retval;
+  }
+
+  // Set once the pool of this thread is destroyed, which at exit comes before the containers of static storage duration are.
+  // Their blocks then go straight to the heap.
+  static bool& retired()
+  {
+    thread_local bool retval = false;
+    return retval;
+  }
+
+public:
+  using value_type = T;
+
+  pool_allocator() = default;
+  template <typename U>
+  pool_allocator(const pool_allocator<U>&)
+  {
+  }
+
+  T* allocate(std::size_t n)
+  {
+    if (retired())
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+
+    auto& p = local_pool();
+    if (p.block_size == 0)
+      p.block_size = n;
+    if (n == p.block_size && !std::empty(p.blocks)) {
+      auto retval = p.blocks.back();
+      p.blocks.pop_back();
+      return static_cast<T*>(retval);
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n)
+  {
+    if (retired()) {
+      ::operator delete(ptr);
+      return;
+    }
+
+    auto& p = local_pool();
+    if (n == p.block_size)
+      p.blocks.push_back(ptr);
+    else
+      ::operator delete(ptr);
+  }
+
+  template <typename U>
+  bool operator==(const pool_allocator<U>&) const
+  {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const pool_allocator<U>&) const
+  {
+    return false;
+  }
+};
+
+} // namespace champsim
+
+#endif
@@ -22,6 +22,7 @@
 #include <string>
 
 #include "champsim.h"
+#include "checkpoint.h"
 #include "memory_class.h"
 #include "operable.h"
 #include "util.h"
@@ -76,7 +77,7 @@ public:
 
   const uint64_t CR3_addr;
 
-  PageTableWalker(std::string v1, uint32_t cpu, double freq_scale, std::vector<std::pair<std::size_t, std::size_t>> pscl_dims, uint32_t v10, uint32_t v11,
+  PageTableWalker(std::string v1, uint32_t cpu, champsim::clock_ratio freq_scale, std::vector<std::pair<std::size_t, std::size_t>> pscl_dims, uint32_t v10, uint32_t v11,
                   uint32_t v12, uint32_t v13, uint64_t latency, MemoryRequestConsumer* ll, VirtualMemory& _vmem);
 
   // functions
@@ -84,9 +85,11 @@ public:
   bool add_wq(const PACKET&) override final { assert(0); }
   bool add_pq(const PACKET&) override final { assert(0); }
   bool add_ptwq(const PACKET&) override final { assert(0); }
+  uint64_t functional_access(const functional_request& request) override final;
 
   void return_data(const PACKET& packet) override final;
   void operate() override final;
+  uint64_t next_event_cycle() const override final;
 
   bool handle_read(const PACKET& pkt);
   bool handle_fill(const PACKET& pkt);
@@ -96,6 +99,7 @@ public:
   std::size_t get_size(uint8_t queue_type, uint64_t address) override final;
 
   void print_deadlock() override final;
+  void serialize(champsim::checkpoint_archive& ar);
 };
 
 #endif
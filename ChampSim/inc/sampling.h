@@ -0,0 +1,52 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SAMPLING_H
+#define SAMPLING_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "phase_info.h"
+#include "stats_printer.h"
+
+namespace champsim
+{
+
+/*
+ * Systematic sampling of the simulated region.
+ * The region is divided into units of `interval` instructions. Each unit is fast-forwarded functionally, except for its last
+ * `warmup + length` instructions, which are simulated in detail and of which the last `length` are measured.
+ */
+struct sampling_config {
+  uint64_t interval = 0; // zero disables sampling
+  uint64_t warmup = 0;
+  uint64_t length = 0;
+
+  bool enabled() const { return interval > 0; }
+};
+
+// The phases that sample a region of the given number of instructions
+std::vector<phase_info> sampled_phases(const sampling_config& config, uint64_t region_length, const std::vector<std::string>& trace_names);
+
+// Per-window IPC and MPKI, and the mean of each with its 95% confidence interval
+void print_sampling_report(std::ostream& stream, const std::vector<phase_stats>& windows);
+
+} // namespace champsim
+
+#endif
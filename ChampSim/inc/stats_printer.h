@@ -14,11 +14,15 @@
  * limitations under the License.
  */
 
+#ifndef STATS_PRINTER_H
+#define STATS_PRINTER_H
+
 #include <iostream>
 #include <vector>
 
 #include "cache.h"
 #include "dram_controller.h"
+#include "host_profiler.h"
 #include "ooo_cpu.h"
 #include "ptw.h"
 
@@ -33,6 +37,7 @@ struct phase_stats {
 #if defined ENABLE_PTW_STATS
   std::vector<PageTableWalker::stats_type> roi_ptw_stats, sim_ptw_stats;
 #endif
+  host_profile profile; // empty unless the host is profiled
 };
 
 class plain_printer
@@ -54,6 +59,8 @@ class plain_printer
       print(stats);
   }
 
+  void print(const host_profile&);
+
 public:
   plain_printer(std::ostream& str) : stream(str) {}
   void print(phase_stats& stats);
@@ -67,6 +74,7 @@ class json_printer
   void print(O3_CPU::stats_type);
   void print(CACHE::stats_type);
   void print(DRAM_CHANNEL::stats_type);
+  void print(const host_profile&);
 
   std::size_t indent_level = 0;
   std::string indent() const { return std::string(2 * indent_level, ' '); }
@@ -81,3 +89,5 @@ public:
   void print(std::vector<phase_stats>& stats);
 };
 } // namespace champsim
+
+#endif
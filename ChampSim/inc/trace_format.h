@@ -0,0 +1,122 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef TRACE_FORMAT_H
+#define TRACE_FORMAT_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "trace_instruction.h"
+#include "trace_source.h"
+
+namespace champsim
+{
+
+/*
+ * Packed traces hold the same instructions as input_instr traces in records of variable length, and may also record the page that
+ * holds each access. A packed trace begins with PACKED_TRACE_MAGIC and a version byte, which is how the simulator tells it apart from
+ * a trace of fixed-length records. It is named *.cstrace by convention, and may be compressed like any other.
+ *
+ * Each record of version 2 is
+ *   registers  1 byte: which destination (bits 0-1) and source (bits 2-5) register slots are present, is_branch (bit 6), branch_taken (bit 7)
+ *   memory     1 byte: which destination (bits 0-1) and source (bits 2-5) address slots are present, pages follow the operands (bit 6)
+ *   ip         zigzag LEB128 of its difference from the previous ip
+ *   registers  1 byte each for the present slots, destinations first
+ *   addresses  zigzag LEB128 each for the present slots, destinations first. Each is the difference from the previous address of its
+ *              stream, where the destinations and the sources are two streams that run through the whole trace.
+ *   pages      1 byte each for the ip and then for each present address: its page size, with bit 7 set if a LEB128 base VPN follows.
+ *              Otherwise, the base VPN is the address without its page offset.
+ * A slot is present if its register or address is nonzero, since the simulator discards the others.
+ *
+ * Version 1 records begin with a flags byte (is_branch, branch_taken, pages in bits 0-2) and then the numbers of registers and of
+ * addresses in the fields of the version 2 bitmaps. Its ip and addresses are absolute, and its present operands are packed into the
+ * first slots.
+ */
+constexpr std::array<char, 7> PACKED_TRACE_MAGIC = {'C', 'S', 'T', 'R', 'A', 'C', 'E'};
+constexpr uint8_t PACKED_TRACE_VERSION = 2;
+
+// As chosen by O3_CPU::lookup_page_size
+constexpr uint8_t SMALL_PAGE = 1, LARGE_PAGE = 2;
+constexpr unsigned SMALL_PAGE_BITS = 12, LARGE_PAGE_BITS = 21;
+
+struct page_info {
+  uint8_t size = 0; // zero if the trace does not say
+  uint64_t base_vpn = 0;
+};
+
+// Each page is that of the address in the same slot
+struct packed_instr {
+  input_instr instr;
+  page_info ip_page;
+  std::array<page_info, NUM_INSTR_DESTINATIONS> destination_pages;
+  std::array<page_info, NUM_INSTR_SOURCES> source_pages;
+};
+
+// The previous ip and addresses, from which those of a version 2 record are encoded
+struct delta_state {
+  uint64_t ip = 0;
+  uint64_t destination = 0;
+  uint64_t source = 0;
+};
+
+class packed_trace_writer
+{
+  std::ostream& out;
+  std::vector<uint8_t> buffer;
+  uint8_t version;
+  delta_state last;
+
+  void write_v1(const packed_instr& instr);
+  void write_v2(const packed_instr& instr);
+
+public:
+  explicit packed_trace_writer(std::ostream& stream, uint8_t version = PACKED_TRACE_VERSION);
+  ~packed_trace_writer();
+  void write(const packed_instr& instr);
+};
+
+class packed_trace_reader
+{
+  std::unique_ptr<trace_source> source;
+  std::vector<uint8_t> buffer;
+  std::size_t position = 0, end = 0;
+  bool source_ended = false;
+  uint8_t version;
+  delta_state last;
+
+  bool fill();
+
+  template <typename Parser>
+  void read_v1(Parser& parse, packed_instr& instr);
+  template <typename Parser>
+  void read_v2(Parser& parse, packed_instr& instr);
+
+public:
+  // The magic and version have already been read from the source
+  packed_trace_reader(std::unique_ptr<trace_source> src, uint8_t version);
+
+  // Returns false at the end of the trace
+  bool read(packed_instr& instr);
+};
+
+} // namespace champsim
+
+#endif
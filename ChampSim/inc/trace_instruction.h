@@ -49,17 +49,6 @@ struct input_instr {
   unsigned long long source_memory[NUM_INSTR_SOURCES] = {};           // input memory
 };
 
-#if defined(_MULTIPLE_PAGE_SIZE)
-struct page_size_info {
-	public:
-		uint64_t base_vpn_destination[NUM_INSTR_DESTINATIONS] = {};
-    uint64_t base_vpn_source[NUM_INSTR_SOURCES] = {};
-		//TODO: we could use a char for 1 byte to minimize outputfile size
-    uint8_t page_size_destination[NUM_INSTR_DESTINATIONS] = {};
-		uint8_t page_size_source[NUM_INSTR_SOURCES] = {};
-};
-#endif
-
 struct cloudsuite_instr {
   // instruction pointer or PC (Program Counter)
   unsigned long long ip = 0;
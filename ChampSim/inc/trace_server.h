@@ -0,0 +1,50 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef TRACE_SERVER_H
+#define TRACE_SERVER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace champsim::trace_server
+{
+
+/*
+ * A trace server (tracer/trace_server) decompresses each trace once into POSIX shared memory, from which every simulator on the host
+ * that asks for it reads. A simulator connects to the server's socket and sends the absolute name of the trace and a newline; the
+ * server replies with "OK <shared memory name>\n" or "ERR <reason>\n". The connection stays open for as long as the simulator reads
+ * the trace, which holds it in the server's cache. Once no connection holds a trace, the server may evict it to make room for others.
+ *
+ * The shared memory begins with a shared_header, and the trace follows at DATA_OFFSET. The server decompresses it ahead of the
+ * readers, which wait for `available` to pass their position.
+ */
+enum state_type : uint32_t { DECODING, COMPLETE, FAILED };
+
+struct shared_header {
+  std::atomic<uint64_t> available = 0; // bytes of the trace written so far
+  std::atomic<uint32_t> state = DECODING;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free, "The header is shared between processes");
+
+constexpr std::size_t DATA_OFFSET = 4096;
+
+} // namespace champsim::trace_server
+
+#endif
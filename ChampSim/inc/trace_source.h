@@ -0,0 +1,54 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef TRACE_SOURCE_H
+#define TRACE_SOURCE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace champsim
+{
+
+// Set by --trace_decoder_threads. Each trace compressed by xz in several blocks is decompressed by this many threads.
+extern unsigned trace_decoder_threads;
+
+// Set by --trace_server. Compressed traces are read from the trace server listening on this socket, if it serves them.
+extern std::string trace_server_socket;
+
+// The decompressed contents of a trace file
+class trace_source
+{
+public:
+  virtual ~trace_source() = default;
+
+  // Reads up to `size` bytes and returns how many were read, which is fewer only at the end of the trace
+  virtual std::size_t read(char* buf, std::size_t size) = 0;
+
+  // Moves ahead by up to `size` bytes and returns how many were passed, which is fewer only at the end of the trace.
+  // Uncompressed files and xz files of several blocks seek; the others are read and discarded.
+  virtual uint64_t skip(uint64_t size);
+};
+
+// Files compressed by xz or gzip are decompressed within the simulator. Others, such as URLs, are read through the xz, gzip, or wget commands.
+std::unique_ptr<trace_source> open_trace_source(const std::string& fname);
+
+} // namespace champsim
+
+#endif
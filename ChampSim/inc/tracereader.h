@@ -14,84 +14,73 @@
  * limitations under the License.
  */
 
+
 #ifndef TRACEREADER_H
 #define TRACEREADER_H
 
-#include <cstdio>
-#include <deque>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
-#include <variant>
-
-#if defined(__GNUG__) && !defined(__APPLE__)
-#include <ext/stdio_filebuf.h>
-#endif
-
-namespace detail
-{
-void pclose_file(FILE* f);
-}
+#include <thread>
+#include <vector>
 
 #include "instruction.h"
 #include "champsim.h"
 
 class tracereader
 {
-  static uint64_t instr_unique_id;
+  static std::atomic<uint64_t> instr_unique_id;
 
 public:
   const std::string trace_string;
-#if defined(_MULTIPLE_PAGE_SIZE)
-	const std::string trace_ext_string;
-  tracereader(uint8_t cpu_idx, std::string _ts, std::string _txts) : 	trace_string(_ts), 
-																																			trace_ext_string(_txts),
-																																			cpu(cpu_idx) {}
-#else
-  tracereader(uint8_t cpu_idx, std::string _ts) : trace_string(_ts), cpu(cpu_idx) {}
-#endif
-  virtual ~tracereader() = default;
+  tracereader(uint8_t cpu_idx, std::string _ts, bool cloudsuite, uint64_t _skip);
+  virtual ~tracereader();
+
+  ooo_model_instr operator()();
 
-  virtual ooo_model_instr operator()() = 0;
+  // The trace is read over and over. This tells whether the last instruction returned was the last of a pass.
   bool eof() const;
 
 protected:
-  static FILE* get_fptr(std::string fname);
+  uint8_t cpu;
+  bool is_cloudsuite;
+  uint64_t skip; // records passed over before the first, which take their instruction IDs with them
 
-#if defined(__GNUG__) && !defined(__APPLE__)
-  std::unique_ptr<FILE, decltype(&detail::pclose_file)> fp{get_fptr(trace_string), &detail::pclose_file};
-  __gnu_cxx::stdio_filebuf<char> filebuf{fp.get(), std::ios::in};
-#if defined(_MULTIPLE_PAGE_SIZE)
-  std::unique_ptr<FILE, decltype(&detail::pclose_file)> ext_fp{get_fptr(trace_ext_string), &detail::pclose_file};
-  __gnu_cxx::stdio_filebuf<char> ext_filebuf{ext_fp.get(), std::ios::in};
+  // The trace is decoded ahead of the core on a thread of its own, which hands it over in batches through a ring.
+  // Only the decoding thread advances `tail`, and only the core advances `head`, so neither takes a lock unless it must wait.
+  struct batch {
+    std::vector<ooo_model_instr> instrs;
+    bool ends_pass = false; // its last instruction is the last of the trace
+    bool last = false;      // no batch follows, because the trace could not be read
+  };
 
-#endif
-#elif defined(__APPLE__)
-  FILE* fp = get_fptr(trace_string);
-#if defined(_MULTIPLE_PAGE_SIZE)
-	//NO MULTIPAGE SUPPORT FOR APPLE, sorry
-	assert(0);
-#endif
-#endif
+  constexpr static std::size_t batch_size = 1024;
+  constexpr static std::size_t ring_size = 8;
+  std::array<batch, ring_size> ring;
+  std::atomic<std::size_t> head = 0, tail = 0;
+  std::atomic<bool> stopping = false;
+  std::exception_ptr decode_error; // written before the last batch is handed over
 
-  uint8_t cpu;
-  bool eof_ = false;
+  std::mutex wait_mutex;
+  std::condition_variable batch_ready, slot_ready;
+
+  batch current;
+  std::size_t current_pos = 0;
+  bool pass_ended = false;
 
-  constexpr static std::size_t buffer_size = 128;
-  constexpr static std::size_t refresh_thresh = 1;
-  std::deque<ooo_model_instr> instr_buffer;
+  std::thread decoder;
 
-  template <typename T>
-  void refresh_buffer();
+  void decode();
 
-  template <typename T>
-  ooo_model_instr impl_get();
+  bool push(batch& b);
+  void pop();
 };
 
-#if defined(_MULTIPLE_PAGE_SIZE)
-std::unique_ptr<tracereader> get_tracereader(	std::string fname, std::string ext_fname, 
-																							uint8_t cpu, bool is_cloudsuite);
-#else
-std::unique_ptr<tracereader> get_tracereader(std::string fname, uint8_t cpu, bool is_cloudsuite);
-#endif
+// Traces are either packed, as described in trace_format.h, or of fixed-length records of the type chosen by is_cloudsuite
+std::unique_ptr<tracereader> get_tracereader(std::string fname, uint8_t cpu, bool is_cloudsuite, uint64_t skip = 0);
 
 #endif
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <optional>
 #include <vector>
 
@@ -76,6 +77,12 @@ std::pair<It, It> get_span_p(It begin, It end, typename std::iterator_traits<It>
   return {span_begin, std::find_if_not(span_begin, span_end, std::forward<F>(func))};
 }
 
+template <typename T>
+constexpr T saturating_add(T lhs, T rhs)
+{
+  return (std::numeric_limits<T>::max() - lhs < rhs) ? std::numeric_limits<T>::max() : lhs + rhs;
+}
+
 } // namespace champsim
 
 #endif
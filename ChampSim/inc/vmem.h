@@ -19,9 +19,15 @@
 
 #include <cstdint>
 #include <deque>
-#include <map>
+#include <functional>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "champsim_constants.h"
+#include "checkpoint.h"
 
 #if defined(MULTIPLE_PAGE_SIZE)
 #define LARGE_PAGE_SIZE 2097152 
@@ -38,16 +44,32 @@ inline constexpr std::size_t PTE_BYTES = 8;
 class VirtualMemory
 {
 private:
-  std::map<std::pair<uint32_t, uint64_t>, uint64_t> vpage_to_ppage_map;
-  std::map<std::tuple<uint32_t, uint64_t, uint32_t>, uint64_t> page_table;
+  // Every page walk looks up both maps, so they are hashed rather than ordered
+  struct page_key_hash {
+    std::size_t operator()(const std::pair<uint32_t, uint64_t>& key) const { return std::hash<uint64_t>{}(key.second * 31 + key.first); }
+    std::size_t operator()(const std::tuple<uint32_t, uint64_t, uint32_t>& key) const
+    {
+      auto [cpu_num, vpage, level] = key;
+      return std::hash<uint64_t>{}((vpage * 31 + cpu_num) * 31 + level);
+    }
+  };
+
+  std::unordered_map<std::pair<uint32_t, uint64_t>, uint64_t, page_key_hash> vpage_to_ppage_map;
+  std::unordered_map<std::tuple<uint32_t, uint64_t, uint32_t>, uint64_t, page_key_hash> page_table;
 
   uint64_t next_pte_page = 0;
 
   uint64_t next_ppage;
   uint64_t last_ppage;
 
-  uint64_t ppage_front() const;
-  void ppage_pop();
+  // Per-CPU allocation streams, used when cores translate concurrently
+  static constexpr uint64_t CPU_STREAM_PAGES = 512;
+  uint64_t cpu_stream_base = 0;
+  std::vector<uint64_t> cpu_next_ppage, cpu_next_pte_page;
+  std::mutex mutex;
+
+  uint64_t ppage_front(uint32_t cpu_num) const;
+  void ppage_pop(uint32_t cpu_num);
 
 public:
   const uint64_t minor_fault_penalty;
@@ -64,8 +86,10 @@ public:
   uint64_t shamt(std::size_t level) const;
   uint64_t get_offset(uint64_t vaddr, std::size_t level) const;
   std::size_t available_ppages() const;
+  void split_by_cpu(std::size_t num_cpus);
   std::pair<uint64_t, uint64_t> va_to_pa(uint32_t cpu_num, uint64_t vaddr);
   std::pair<uint64_t, uint64_t> get_pte_pa(uint32_t cpu_num, uint64_t vaddr, std::size_t level);
+  void serialize(champsim::checkpoint_archive& ar);
 };
 
 #endif
@@ -87,7 +87,11 @@ public:
 std::map<CACHE*, tracker> trackers;
 } // namespace
 
-void CACHE::prefetcher_initialize() { std::cout << NAME << " IP-based stride prefetcher" << std::endl; }
+void CACHE::prefetcher_initialize()
+{
+  std::cout << NAME << " IP-based stride prefetcher" << std::endl;
+  ::trackers[this];
+}
 
 void CACHE::prefetcher_cycle_operate() { ::trackers[this].advance_lookahead(this); }
 
@@ -69,7 +69,7 @@ uint64_t calc_tag_val(uint64_t pc)
 */
 using namespace champsim;
 
-inline unsigned int make_signature(uint64_t pc, std::string NAME)
+inline unsigned int make_signature(uint64_t pc, std::string NAME, const champsim::branch_history* history)
 {
 	//FIXME: maybe use champsim's
 	//uint64_t set_mix = calc_set_index(pc);
@@ -78,13 +78,17 @@ inline unsigned int make_signature(uint64_t pc, std::string NAME)
 	//uint64_t pc_off = pc >> sam_blk_offset;
 	//int a = sam_index_offset - group;
 
+	// A cache shared between cores follows the history of none of them
+	if (history == nullptr)
+		return 0;
+
 	unsigned int mixed = 0;
 	if (NAME.compare("cpu0_ITLB") == 0) {
-			mixed = (pc) ^ (condHistory_old) ^ (uncondIndHistory_old) ^ (global_path_history_MHRP);
+			mixed = (pc) ^ (history->condHistory_old) ^ (history->uncondIndHistory_old) ^ (history->global_path_history_MHRP);
 	} else if (NAME.compare("cpu0_DTLB") == 0) {
-			mixed = (pc) ^ (condHistory_old) ^ (uncondIndHistory_old) ^ (global_path_history_MHRP);
+			mixed = (pc) ^ (history->condHistory_old) ^ (history->uncondIndHistory_old) ^ (history->global_path_history_MHRP);
 	} else if (NAME.compare("cpu0_STLB") == 0) {
-			mixed = (pc) ^  (condHistory_old) ^ (uncondIndHistory_old) ^ (global_path_history_MHRP);
+			mixed = (pc) ^  (history->condHistory_old) ^ (history->uncondIndHistory_old) ^ (history->global_path_history_MHRP);
 	}
 /*
 	if ( way_test == 1010){
@@ -132,6 +136,21 @@ void CACHE::initialize_replacement()
 	::_sampler = new sampler(NUM_SET, NUM_WAY, ::_sampler_set, ::_sampler_assoc);
 	::_predTable = new predTable(pred_table_index_bits, num_tables);
 
+	champsim::register_checkpoint_function(this, "chirp", [this](champsim::checkpoint_archive& ar) {
+		ar.io(::last_used_cycles[this]);
+		ar.io(::is_dead[this]);
+		ar.expect(::_sampler->nsampler_sets);
+		ar.expect(::sampler_assoc);
+		for (int i = 0; i < ::_sampler->nsampler_sets; i++)
+			for (int j = 0; j < ::sampler_assoc; j++)
+				ar.io(::_sampler->samp_sets[i].blocks[j]);
+		ar.expect(::_predTable->predictor_tables);
+		ar.expect(::_predTable->predictor_table_entries);
+		for (int i = 0; i < ::_predTable->predictor_tables; i++)
+			for (int j = 0; j < ::_predTable->predictor_table_entries; j++)
+				ar.io(::_predTable->tables[i][j]);
+	});
+
 	std::cout << "CHiRPing..." << std::endl;
 }
 
@@ -140,7 +159,7 @@ uint32_t CACHE::find_victim(uint32_t triggering_cpu, uint64_t instr_id, uint32_t
 {
 	nvict++;
 	uint32_t way = NUM_WAY;
-	unsigned int trace = make_signature(ip, NAME);
+	unsigned int trace = make_signature(ip, NAME, branch_history);
 	// not sure when and why we bypass
 	bool prediction_bypass;
 	int pred_confindence = ::_predTable->get_prediction(module_type, trace);
@@ -191,7 +210,7 @@ void CACHE::update_replacement_state(	uint32_t triggering_cpu, uint32_t set, uin
 																			uint64_t full_addr, uint64_t ip, uint64_t victim_addr, 
 																			uint32_t type, uint8_t hit, REP_POL_XARGS xargs)
 {
-	unsigned int trace = make_signature(ip, NAME);
+	unsigned int trace = make_signature(ip, NAME, branch_history);
 	int pred_confidence = ::_predTable->get_prediction(module_type, trace);
 	if (pred_confidence >= cache_thresh) {
 		is_dead[this].at(set * NUM_WAY + way) = true;
@@ -218,7 +237,7 @@ void CACHE::update_replacement_state(	uint32_t triggering_cpu, uint32_t set, uin
 		bool deadFound = false;
 		bool feedback = false;
 		uint32_t victim = 88; // dummy val
-		uint64_t trace_current = make_signature(ip, NAME);
+		uint64_t trace_current = make_signature(ip, NAME, branch_history);
 		for (uint32_t i = 0; i < ::_sampler_assoc; i++) {
 			if ((blocks[i].valid == true) && (blocks[i].tag == full_addr)) {
 				matchFound = true;
@@ -80,6 +80,7 @@ void CACHE::initialize_replacement()
 	::last_used_cycles[this] = std::vector<uint64_t>(NUM_SET * NUM_WAY); 
 	::least_recently_used[this] = std::vector<uint32_t>(NUM_SET * NUM_WAY);
 	::freq_cnt[this] = std::vector<SatCnt>(NUM_SET * NUM_WAY, SatCnt(3));
+	champsim::register_checkpoint_state(this, "itp", ::last_used_cycles[this], ::least_recently_used[this], ::freq_cnt[this], ::vpn_freq_acc);
 }
 
 // called on every cache hit and cache fill
@@ -21,6 +21,7 @@ uint32_t get_lfu_hit_position(std::vector<uint64_t>::iterator begin,std::vector<
 void CACHE::initialize_replacement() { 
   std::cout << NAME << " LFU " << " SETS: " << NUM_SET << " WAYS: " << NUM_WAY << " SIZE: " << NUM_SET * NUM_WAY * 64 / 1024 << "KB" << std::endl;
   ::freq_ctr[this] = std::vector<uint64_t>(NUM_SET * NUM_WAY, 0); 
+  champsim::register_checkpoint_state(this, "lfu", ::freq_ctr[this]);
   // hit_position = std::vector<uint64_t>(NUM_WAY, 0); 
 }
 
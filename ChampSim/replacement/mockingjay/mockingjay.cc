@@ -1,3 +1,4 @@
+#include <map>
 #include <unordered_map>
 #include <stdlib.h>
 #include "cache.h"
@@ -170,6 +171,21 @@ void CACHE::initialize_replacement()
             }
         }
     }
+
+    champsim::register_checkpoint_function(this, "mockingjay", [](champsim::checkpoint_archive& ar) {
+        ar.io(etr);
+        ar.io(etr_clock);
+        ar.io(current_timestamp);
+        ar.io(rdp);
+
+        map<uint32_t, SampledCacheLine*> ordered(sampled_cache.begin(), sampled_cache.end());
+        ar.expect(ordered.size());
+        for (auto [index, lines] : ordered) {
+            ar.expect(index);
+            for (int i = 0; i < SAMPLED_CACHE_WAYS; i++)
+                ar.io(lines[i]);
+        }
+    });
 }
 
 
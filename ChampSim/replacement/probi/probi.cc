@@ -30,6 +30,7 @@ void CACHE::initialize_replacement()
 						<< instr_eviction_prob << "%" << std::endl;
 
 	::last_used_cycles[this] = std::vector<LRUStackElem>(NUM_SET * NUM_WAY); 
+	champsim::register_checkpoint_state(this, "probi", ::last_used_cycles[this]);
 
   srand((unsigned) time(NULL));
 }
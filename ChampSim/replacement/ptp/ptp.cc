@@ -51,6 +51,8 @@ void CACHE::initialize_replacement()
 	::total_evictions[this] = 0;
 	::current_tlb_stress_threshold[this] = 0;
 	::least_recently_used[this] = std::vector<eviction_entry>(NUM_SET * NUM_WAY); 
+	champsim::register_checkpoint_state(this, "ptp", ::least_recently_used[this], ::current_pte_eviction_ratio[this], ::total_pte_evictions[this],
+	                                    ::total_evictions[this], ::current_tlb_stress_threshold[this]);
 }
 
 // find replacement victim
@@ -8,7 +8,11 @@ std::unordered_map<CACHE*, std::vector<int>> rrpv_values;
 } // namespace
 
 // initialize replacement state
-void CACHE::initialize_replacement() { ::rrpv_values[this] = std::vector<int>(NUM_SET * NUM_WAY, ::maxRRPV); }
+void CACHE::initialize_replacement()
+{
+  ::rrpv_values[this] = std::vector<int>(NUM_SET * NUM_WAY, ::maxRRPV);
+  champsim::register_checkpoint_state(this, "srrip", ::rrpv_values[this]);
+}
 
 // find replacement victim
 uint32_t CACHE::find_victim(uint32_t triggering_cpu, uint64_t instr_id, uint32_t set, const BLOCK* current_set, uint64_t ip, uint64_t full_addr, uint32_t type)
@@ -38,6 +38,13 @@ void CACHE::initialize_replacement()
   }
 
   ::rrpv.insert({this, std::vector<unsigned>(NUM_SET * NUM_WAY)});
+
+  champsim::register_checkpoint_function(this, "tdrrip", [this](champsim::checkpoint_archive& ar) {
+    ar.io(::bip_counter[this]);
+    ar.io(::rrpv[this]);
+    for (std::size_t i = 0; i < NUM_CPUS; ++i)
+      ar.io(::PSEL[std::make_pair(this, i)]);
+  });
 }
 
 // called on every cache hit and cache fill
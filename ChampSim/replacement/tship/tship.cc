@@ -56,6 +56,13 @@ void CACHE::initialize_replacement()
   sampler.emplace(this, ::SAMPLER_SET * NUM_WAY);
 
   ::rrpv_values[this] = std::vector<int>(NUM_SET * NUM_WAY, ::maxRRPV);
+
+  champsim::register_checkpoint_function(this, "tship", [this](champsim::checkpoint_archive& ar) {
+    ar.io(::sampler[this]);
+    ar.io(::rrpv_values[this]);
+    for (std::size_t i = 0; i < NUM_CPUS; ++i)
+      ar.io(::SHCT[std::make_pair(this, i)]);
+  });
 }
 
 // find replacement victim
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <map>
 #include <string>
@@ -12,7 +13,7 @@
  */
 
 //#define MIN_EVICTION_POSITION 6
-extern double STLB_MPKI;
+extern std::atomic<double> STLB_MPKI;
 
 namespace {
 
@@ -65,6 +66,7 @@ void CACHE::initialize_replacement()
 	std::cout << "\tMIN_EVICTION_POSITION:" << ::MIN_EVICTION_POSITION[this] << std::endl;
 
 	::least_recently_used[this] = std::vector<eviction_entry>(NUM_SET * NUM_WAY); 
+	champsim::register_checkpoint_state(this, "xptp", ::least_recently_used[this]);
 }
 
 // find replacement victim
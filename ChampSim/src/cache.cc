@@ -17,6 +17,7 @@
 #include "cache.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iomanip>
 #include <iterator>
 #include <numeric>
@@ -35,8 +36,8 @@
 				//#endif
 
 				#if defined PTP_REPLACEMENT_POLICY
-				extern uint64_t RETIRED_INSTRS;
-				extern double STLB_MPKI;
+				extern std::atomic<uint64_t> RETIRED_INSTRS;
+				extern std::atomic<double> STLB_MPKI;
 				#endif
 
 				bool CACHE::handle_fill(const PACKET& fill_mshr)
@@ -730,6 +731,23 @@ if (((NAME.find("L1I") != std::string::npos) || (NAME.find("L1D") != std::string
 					impl_prefetcher_cycle_operate();
 				}
 
+				// Prefetchers that issue from prefetcher_cycle_operate() (e.g. ip_stride) are not visible here
+				uint64_t CACHE::next_event_cycle() const
+				{
+					uint64_t next = std::numeric_limits<uint64_t>::max();
+
+					for (auto q : {std::cref(MSHR), std::cref(inflight_writes)})
+						if (!std::empty(q.get()))
+							next = std::min(next, q.get().front().event_cycle);
+
+					// The queues keep their own clock, which may tick ahead of ours within a cycle
+					for (auto q : {std::cref(queues.WQ), std::cref(queues.PTWQ), std::cref(queues.RQ), std::cref(queues.PQ)})
+						if (!std::empty(q.get()))
+							next = std::min(next, std::max<uint64_t>(queues.ready_cycle(q.get().front()), 1) - 1);
+
+					return std::max(next, current_cycle);
+				}
+
 				#if defined (SPLIT_STLB)
 
 				uint64_t CACHE::get_set(uint64_t address, uint8_t type) const { return get_set_index(address, type); }
@@ -879,6 +897,136 @@ bool CACHE::add_ptwq(const PACKET& packet)
   return queues.add_ptwq(packet);
 }
 
+// The tag lookup, fill and replacement update of try_hit() and handle_fill(), without the queues, the prefetchers or the statistics
+// that only timed phases report
+uint64_t CACHE::functional_access(const functional_request& request)
+{
+  auto req = request;
+  queues.functional_translate(req);
+  cpu = req.cpu;
+
+#if defined(SPLIT_STLB)
+  const auto set = get_set_index(req.address, req.is_instr);
+  auto [set_begin, set_end] = get_set_span(req.address, req.is_instr);
+#else
+  const auto set = get_set_index(req.address);
+  auto [set_begin, set_end] = get_set_span(req.address);
+#endif
+
+  auto update_replacement = [&](std::size_t way_idx, uint64_t victim_addr, [[maybe_unused]] bool hit) {
+#if defined ENABLE_TRANSLATION_AWARE_REPLACEMENT
+    REP_POL_XARGS xargs;
+    xargs.is_instr = req.is_instr;
+    xargs.is_pte = req.is_pte;
+    xargs.translation_level = req.translation_level;
+    impl_update_replacement_state(req.cpu, static_cast<uint32_t>(set), static_cast<uint32_t>(way_idx), req.address, req.ip, victim_addr, req.type, false, xargs);
+#else
+    impl_update_replacement_state(req.cpu, static_cast<uint32_t>(set), static_cast<uint32_t>(way_idx), req.address, req.ip, victim_addr, req.type, hit);
+#endif
+  };
+
+  if (auto way = std::find_if(set_begin, set_end, eq_addr<BLOCK>(req.address, OFFSET_BITS)); way != set_end) {
+    sim_stats.back().hits[req.type][req.cpu]++;
+    update_replacement(static_cast<std::size_t>(std::distance(set_begin, way)), 0, true);
+    way->dirty = (req.type == WRITE);
+    way->prefetch = false;
+    return way->data;
+  }
+
+#if defined FORCE_HIT
+  if (force_hit && !req.is_instr) {
+    if (is_stlb && req.translation_level == 0) {
+      sim_stats.back().hits[req.type][req.cpu]++;
+      return vmem->va_to_pa(req.cpu, req.v_address).first;
+    }
+
+    if (is_l1d && req.is_pte) {
+      if (auto cached = cached_PTEs.find(req.address); cached != std::end(cached_PTEs)) {
+        sim_stats.back().hits[req.type][req.cpu]++;
+        return cached->second.data;
+      }
+    }
+  }
+#endif
+
+#if defined(MULTIPLE_PAGE_SIZE)
+  // A large page hits on any entry of the same page, wherever it was filled
+  if (is_tlb && req.page_size == 2) {
+    auto same_page = [base_vpn = req.base_vpn](const BLOCK& x) { return x.base_vpn == base_vpn; };
+    if (std::any_of(std::cbegin(block), std::cend(block), same_page)) {
+      sim_stats.back().hits[req.type][req.cpu]++;
+      return vmem->va_to_pa(req.cpu, req.v_address).first;
+    }
+  }
+#endif
+
+  sim_stats.back().misses[req.type][req.cpu]++;
+
+#if defined PTP_REPLACEMENT_POLICY
+  if (is_stlb)
+    STLB_MPKI = (static_cast<double>(sim_stats.back().misses[req.type][req.cpu]) * 1000.0) / static_cast<double>(RETIRED_INSTRS);
+#endif
+
+  // Writebacks fill this level without reading from below
+  if (req.type != WRITE || match_offset_bits) {
+    auto fwd = req;
+    if (fwd.type == WRITE)
+      fwd.type = RFO;
+    req.data = lower_level->functional_access(fwd);
+  }
+
+  auto way = std::find_if_not(set_begin, set_end, [](const BLOCK& x) { return x.valid; });
+  if (way == set_end)
+    way = std::next(set_begin, impl_find_victim(req.cpu, req.instr_id, static_cast<uint32_t>(set), &*set_begin, req.ip, req.address, req.type));
+  const auto way_idx = static_cast<std::size_t>(std::distance(set_begin, way));
+
+  // Bypass
+  if (way == set_end) {
+    update_replacement(way_idx, 0, false);
+    return req.data;
+  }
+
+  if (way->valid && way->dirty) {
+    functional_request writeback;
+    writeback.type = WRITE;
+    writeback.cpu = req.cpu;
+    writeback.address = way->address;
+    writeback.data = way->data;
+    writeback.instr_id = req.instr_id;
+#if defined ENABLE_EXTRA_CACHE_STATS || defined FORCE_HIT
+    writeback.is_instr = way->is_instr;
+    writeback.is_pte = way->is_pte;
+#endif
+    lower_level->functional_access(writeback);
+  }
+
+#if defined FORCE_HIT
+  if (is_l1d && force_hit && way->is_pte && !way->is_instr)
+    cached_PTEs[way->address] = *way;
+#endif
+
+  auto evicting_address = (ever_seen_data ? way->address : way->v_address) & ~champsim::bitmask(match_offset_bits ? 0 : OFFSET_BITS);
+
+  way->valid = true;
+  way->prefetch = false;
+  way->dirty = (req.type == WRITE);
+  way->address = req.address;
+  way->v_address = req.v_address;
+  way->data = req.data;
+  way->pf_metadata = 0;
+#if defined ENABLE_EXTRA_CACHE_STATS || defined FORCE_HIT
+  way->is_instr = req.is_instr;
+  way->is_pte = req.is_pte;
+#endif
+#if defined(MULTIPLE_PAGE_SIZE)
+  way->page_size = req.page_size;
+  way->base_vpn = req.base_vpn;
+#endif
+
+  update_replacement(way_idx, evicting_address, false);
+  return req.data;
+}
+
 int CACHE::prefetch_line(uint64_t pf_addr, bool fill_this_level, uint32_t prefetch_metadata)
 {
   sim_stats.back().pf_requested++;
@@ -1118,3 +1266,14 @@ void CACHE::print_deadlock()
     std::cout << NAME << " PQ empty" << std::endl;
   }
 }
+
+void CACHE::serialize(champsim::checkpoint_archive& ar)
+{
+  ar.expect(NUM_SET);
+  ar.expect(NUM_WAY);
+  ar.io(block);
+  ar.io(ever_seen_data);
+#if defined FORCE_HIT || defined FORCE_PTE_HIT || defined MULTIPLE_PAGE_SIZE
+  ar.io(cached_PTEs);
+#endif
+}
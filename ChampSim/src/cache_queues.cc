@@ -267,6 +267,39 @@ bool CACHE::NonTranslatingQueues::is_ready(const PACKET& pkt) const { return pkt
 
 bool CACHE::TranslatingQueues::is_ready(const PACKET& pkt) const { return NonTranslatingQueues::is_ready(pkt) && pkt.address != 0 && pkt.is_translated; }
 
+uint64_t CACHE::NonTranslatingQueues::ready_cycle(const PACKET& pkt) const { return pkt.event_cycle; }
+
+uint64_t CACHE::TranslatingQueues::ready_cycle(const PACKET& pkt) const
+{
+  return (pkt.address != 0 && pkt.is_translated) ? NonTranslatingQueues::ready_cycle(pkt) : std::numeric_limits<uint64_t>::max();
+}
+
+uint64_t CACHE::NonTranslatingQueues::next_event_cycle() const
+{
+  // Collision checks happen as soon as a packet is added
+  auto unchecked = [](const auto& queue) { return std::any_of(std::begin(queue), std::end(queue), std::not_fn(&PACKET::forward_checked)); };
+  if (unchecked(WQ) || unchecked(RQ) || unchecked(PQ))
+    return current_cycle;
+  return std::numeric_limits<uint64_t>::max();
+}
+
+uint64_t CACHE::TranslatingQueues::next_event_cycle() const
+{
+  auto untranslated = [](const auto& queue) {
+    return std::any_of(std::begin(queue), std::end(queue), [](const auto& x) { return !x.translate_issued && x.address == x.v_address; });
+  };
+  if (untranslated(WQ) || untranslated(RQ) || untranslated(PQ))
+    return current_cycle;
+
+  // Translation misses are detected the cycle after the packet would have been ready
+  auto next = NonTranslatingQueues::next_event_cycle();
+  for (auto queue : {std::cref(WQ), std::cref(RQ), std::cref(PQ)}) {
+    if (!std::empty(queue.get()) && queue.get().front().address == 0)
+      next = std::min(next, champsim::saturating_add<uint64_t>(queue.get().front().event_cycle, 1));
+  }
+  return std::max(next, current_cycle);
+}
+
 bool CACHE::NonTranslatingQueues::wq_has_ready() const { return is_ready(WQ.front()); }
 
 bool CACHE::NonTranslatingQueues::rq_has_ready() const { return is_ready(RQ.front()); }
@@ -313,6 +346,19 @@ void CACHE::TranslatingQueues::return_data(const PACKET& packet)
   }
 }
 
+void CACHE::TranslatingQueues::functional_translate(functional_request& request)
+{
+  // Page walks are not translated, as they do not pass through the translating queues
+  if (request.type == TRANSLATION || request.address != request.v_address)
+    return;
+
+  auto fwd = request;
+  fwd.type = LOAD;
+  auto ppage = lower_level->functional_access(fwd);
+
+  request.address = champsim::splice_bits(ppage, request.v_address, LOG2_PAGE_SIZE); // translated address
+}
+
 void CACHE::NonTranslatingQueues::begin_phase()
 {
   roi_stats.emplace_back();
@@ -21,17 +21,28 @@
 #include <bitset>
 #include <chrono>
 #include <cmath>
+#include <deque>
 #include <fstream>
 #include <functional>
 #include <getopt.h>
 #include <iomanip>
+#include <limits>
 #include <numeric>
+#include <sstream>
+#include <stdexcept>
 #include <string.h>
 #include <vector>
 
+#include "cache.h"
+#include "checkpoint.h"
+#include "clock_schedule.h"
+#include "dram_controller.h"
+#include "host_profiler.h"
 #include "ooo_cpu.h"
 #include "operable.h"
+#include "parallel_sim.h"
 #include "phase_info.h"
+#include "ptw.h"
 #include "tracereader.h"
 
 auto start_time = std::chrono::steady_clock::now();
@@ -50,92 +61,270 @@ struct phase_info {
   bool is_warmup;
   uint64_t length;
 };
-#if defined(_MULTIPLE_PAGE_SIZE)
-int champsim_main(std::vector<std::reference_wrapper<O3_CPU>>& ooo_cpu, std::vector<std::reference_wrapper<champsim::operable>>& operables,
-                  std::vector<champsim::phase_info>& phases, bool knob_cloudsuite, std::vector<std::string> trace_names, std::vector<std::string> trace_ext_names)
-#else
+
+// Bounds the wait for the simulator to settle before a fast-forward, in case a component never goes idle
+constexpr uint64_t MAX_DRAIN_CYCLES = 1000000;
+
+// The name under which a component's host time is reported
+std::string profile_name(champsim::operable& op, std::vector<std::reference_wrapper<champsim::operable>>& operables)
+{
+  if (auto cpu = dynamic_cast<O3_CPU*>(&op); cpu != nullptr)
+    return "cpu" + std::to_string(cpu->cpu);
+  if (auto cache = dynamic_cast<CACHE*>(&op); cache != nullptr)
+    return cache->NAME;
+  if (auto ptw = dynamic_cast<PageTableWalker*>(&op); ptw != nullptr)
+    return ptw->NAME;
+  if (dynamic_cast<MEMORY_CONTROLLER*>(&op) != nullptr)
+    return "DRAM";
+  for (champsim::operable& other : operables)
+    if (auto cache = dynamic_cast<CACHE*>(&other); cache != nullptr && static_cast<champsim::operable*>(&cache->queues) == &op)
+      return cache->NAME + "_queues";
+  return "unnamed component";
+}
+
+// Advance the clock of every component past cycles in which none of them can act.
+// Each skipped tick is ordered exactly as if it had been simulated.
+// Where the components are seldom all idle, polling them every cycle costs more than the skips save. After a failed attempt,
+// the next one waits twice as long as the last wait, up to MAX_SKIP_BACKOFF cycles, and first asks the component that was busy.
+class idle_cycle_skipper
+{
+  static constexpr uint64_t MAX_SKIP_BACKOFF = 64;
+
+  uint64_t wait = 0;
+  uint64_t backoff = 0;
+  std::size_t last_busy = 0;
+
+public:
+  void operator()(champsim::clock_schedule& schedule)
+  {
+    if (wait > 0) {
+      --wait;
+      return;
+    }
+
+    auto fail = [this](std::size_t busy) {
+      last_busy = busy;
+      backoff = std::clamp<uint64_t>(2 * backoff, 1, MAX_SKIP_BACKOFF);
+      wait = backoff;
+    };
+
+    if (schedule.at(last_busy).next_event_cycle() <= schedule.at(last_busy).current_cycle)
+      return fail(last_busy);
+
+    std::vector<uint64_t> next_events;
+    for (std::size_t i = 0; i < schedule.size(); ++i)
+      next_events.push_back(schedule.at(i).next_event_cycle());
+
+    auto is_idle = [&](std::size_t i) { return schedule.at(i).current_cycle < next_events[i]; };
+    if (auto busy = std::find_if_not(std::cbegin(schedule.next()), std::cend(schedule.next()), is_idle); busy != std::cend(schedule.next()))
+      return fail(*busy);
+
+    backoff = 0;
+    while (std::all_of(std::cbegin(schedule.next()), std::cend(schedule.next()), is_idle)) {
+      for (auto i : schedule.next())
+        schedule.at(i)._idle();
+      schedule.advance();
+    }
+  }
+};
+
 int champsim_main(std::vector<std::reference_wrapper<O3_CPU>>& ooo_cpu, std::vector<std::reference_wrapper<champsim::operable>>& operables,
-                  std::vector<champsim::phase_info>& phases, bool knob_cloudsuite, std::vector<std::string> trace_names)
-#endif
+                  std::vector<champsim::phase_info>& phases, bool knob_cloudsuite, bool knob_skip_idle, champsim::parallel_config parallel, champsim::checkpoint_config checkpoint, uint64_t skip_instructions, std::vector<std::string> trace_names)
 {
+  // Components are registered before they initialize, so that they may register their own parts within them
+  for (champsim::operable& op : operables)
+    op.profile = champsim::register_profile_counter(profile_name(op, operables));
+  std::vector<champsim::profile_counter*> trace_profile;
+  for (O3_CPU& cpu : ooo_cpu)
+    trace_profile.push_back(champsim::register_profile_counter("cpu" + std::to_string(cpu.cpu) + " trace read"));
+
   for (champsim::operable& op : operables)
     op.initialize();
 
-  std::vector<std::unique_ptr<tracereader>> traces;
-  for (auto name : trace_names)
-#if defined(_MULTIPLE_PAGE_SIZE)
-		//FIXME: Only works for 1 core
-    traces.push_back(get_tracereader(name, trace_ext_names[0], traces.size(), knob_cloudsuite));
-#else
-    traces.push_back(get_tracereader(name, traces.size(), knob_cloudsuite));
-#endif
+  // The instructions that retired before the checkpoint was taken are skipped with the rest
+  uint64_t restored_cycles = 0;
+  if (!std::empty(checkpoint.load_path))
+    restored_cycles = champsim::load_checkpoint(checkpoint.load_path, operables);
+
+  // The hardware threads of each core take the traces in turn
+  std::vector<std::vector<std::unique_ptr<tracereader>>> traces(std::size(ooo_cpu));
+  std::size_t next_trace = 0;
+  for (O3_CPU& cpu : ooo_cpu) {
+    for (auto& thread : cpu.threads) {
+      if (next_trace >= std::size(trace_names))
+        throw std::invalid_argument("The cores have more hardware threads than there are traces");
+      traces.at(cpu.cpu).push_back(get_tracereader(trace_names.at(next_trace++), cpu.cpu, knob_cloudsuite, skip_instructions + thread.num_retired));
+    }
+  }
+
+  auto next_instr = [&](O3_CPU& cpu, std::size_t thread) {
+    auto& trace = traces.at(cpu.cpu).at(thread);
+    auto instr = (*trace)();
+    cpu.assign_thread(instr, static_cast<uint8_t>(thread));
+
+    // The reader has already begun the next pass over the trace
+    if (trace->eof()) {
+      std::ostringstream line;
+      line << "*** Reached end of trace: " << trace->trace_string << std::endl;
+      std::cout << line.str() << std::flush;
+    }
+
+    return instr;
+  };
+
+  auto refill = [&](O3_CPU& cpu) {
+    champsim::profile_scope timer{trace_profile.at(cpu.cpu)};
+    for (std::size_t thread = 0; thread < std::size(cpu.threads); ++thread) {
+      auto& input_queue = cpu.threads[thread].input_queue;
+      auto num_instrs = cpu.IN_QUEUE_SIZE - std::size(input_queue);
+      for (std::size_t i = 0; i < num_instrs; ++i)
+        input_queue.push_back(next_instr(cpu, thread));
+    }
+  };
+
+  auto input_full = [](const O3_CPU& cpu) {
+    return std::all_of(std::cbegin(cpu.threads), std::cend(cpu.threads),
+                       [size = static_cast<std::size_t>(cpu.IN_QUEUE_SIZE)](const auto& x) { return std::size(x.input_queue) >= size; });
+  };
+
+  champsim::clock_schedule schedule{operables};
+  idle_cycle_skipper skip_idle_cycles;
+
+  auto operate_cycle = [&]() {
+    for (auto i : schedule.next()) {
+      try {
+        schedule.at(i)._operate();
+      } catch (champsim::deadlock& dl) {
+        // ooo_cpu[dl.which].print_deadlock();
+        // std::cout << std::endl;
+        // for (auto c : caches)
+        for (champsim::operable& c : operables) {
+          c.print_deadlock();
+          std::cout << std::endl;
+        }
+
+        abort();
+      }
+    }
+    schedule.advance();
+  };
+
+  if (!std::empty(checkpoint.load_path))
+    schedule.seek(restored_cycles);
+
+  // Fast-forwarding between detailed phases drains the simulator on the serial schedule
+  auto fast_forwards = std::size(phases) > 1 && std::any_of(std::next(std::cbegin(phases)), std::cend(phases), [](const auto& x) { return x.is_functional; });
+
+  std::unique_ptr<champsim::parallel_engine> engine;
+  if (parallel.quantum > 0 && fast_forwards) {
+    std::cout << "WARNING: sampled simulation is not run in parallel." << std::endl;
+  } else if (parallel.quantum > 0) {
+    engine = std::make_unique<champsim::parallel_engine>(ooo_cpu, operables, parallel);
+    if (!engine->valid()) {
+      std::cout << "WARNING: the cores do not have private hierarchies to simulate in parallel. Falling back to serial simulation." << std::endl;
+      engine.reset();
+    } else if (knob_skip_idle) {
+      std::cout << "WARNING: idle cycles are not skipped in parallel simulation." << std::endl;
+    }
+  }
 
   // simulation entry point
-  for (auto [phase_name, is_warmup, length, ignored] : phases) {
+  bool checkpoint_saved = false;
+  for (auto [phase_name, is_warmup, length, ignored, is_functional, is_timed] : phases) {
     // Initialize phase
     for (champsim::operable& op : operables) {
-      op.warmup = is_warmup;
+      op.warmup = is_warmup && !is_timed;
       op.begin_phase();
     }
+    champsim::begin_host_profile_phase();
 
     // Perform phase
-    std::vector<bool> phase_complete(std::size(ooo_cpu), false);
-    while (!std::accumulate(std::begin(phase_complete), std::end(phase_complete), true, std::logical_and{})) {
-      // Operate
-      for (champsim::operable& op : operables) {
-        try {
-          op._operate();
-        } catch (champsim::deadlock& dl) {
-          // ooo_cpu[dl.which].print_deadlock();
-          // std::cout << std::endl;
-          // for (auto c : caches)
-          for (champsim::operable& c : operables) {
-            c.print_deadlock();
-            std::cout << std::endl;
-          }
-
-          abort();
-        }
+    if (is_functional) {
+      // Let whatever is in flight complete, so that no fill is pending when the functional accesses begin.
+      // The instructions that were read from the trace but not yet fetched are executed functionally instead.
+      std::vector<std::vector<champsim::instr_queue>> pending(std::size(ooo_cpu));
+      for (O3_CPU& cpu : ooo_cpu) {
+        pending.at(cpu.cpu).resize(std::size(cpu.threads));
+        for (std::size_t thread = 0; thread < std::size(cpu.threads); ++thread)
+          std::swap(pending.at(cpu.cpu).at(thread), cpu.threads[thread].input_queue);
+        cpu.flush_prediction();
       }
 
-      std::sort(std::begin(operables), std::end(operables), champsim::by_next_operate());
+      auto busy = [](const champsim::operable& op) { return op.next_event_cycle() != std::numeric_limits<uint64_t>::max(); };
+      for (uint64_t cycle = 0; cycle < MAX_DRAIN_CYCLES && std::any_of(std::cbegin(operables), std::cend(operables), busy); ++cycle)
+        operate_cycle();
 
-      // Read from trace
-      for (O3_CPU& cpu : ooo_cpu) {
-        auto num_instrs = cpu.IN_QUEUE_SIZE - std::size(cpu.input_queue);
-        std::vector<typename decltype(cpu.input_queue)::value_type> from_trace{};
-
-        for (std::size_t i = 0; i < num_instrs; ++i) {
-          from_trace.push_back((*traces[cpu.cpu])());
-
-          // Reopen trace if we've reached the end of the file
-          if (traces[cpu.cpu]->eof()) {
-            auto name = traces[cpu.cpu]->trace_string;
-            std::cout << "*** Reached end of trace: " << name << std::endl;
-#if defined(_MULTIPLE_PAGE_SIZE)
-            traces[cpu.cpu] = get_tracereader(name, trace_ext_names[0], cpu.cpu, knob_cloudsuite);
-#else
-            traces[cpu.cpu] = get_tracereader(name, cpu.cpu, knob_cloudsuite);
-#endif
+      // The cores, and the threads of each, take turns one instruction at a time, so that their accesses interleave in the shared levels
+      auto unfinished = [length = length](const O3_CPU& cpu) { return cpu.sim_instr() < length; };
+      std::vector<std::size_t> next_thread(std::size(ooo_cpu), 0);
+      while (std::any_of(std::cbegin(ooo_cpu), std::cend(ooo_cpu), unfinished)) {
+        for (O3_CPU& cpu : ooo_cpu) {
+          if (!unfinished(cpu))
+            continue;
+
+          auto thread = next_thread.at(cpu.cpu);
+          next_thread.at(cpu.cpu) = (thread + 1) % std::size(cpu.threads);
+          auto& queue = pending.at(cpu.cpu).at(thread);
+          if (std::empty(queue)) {
+            auto read = [&] {
+              champsim::profile_scope timer{trace_profile.at(cpu.cpu)};
+              return next_instr(cpu, thread);
+            };
+            cpu.functional_execute(read());
+          } else {
+            cpu.functional_execute(std::move(queue.front()));
+            queue.pop_front();
           }
         }
 
-        cpu.input_queue.insert(std::cend(cpu.input_queue), std::begin(from_trace), std::end(from_trace));
+        // The clocks tick once per round, so that replacement policies that stamp their accesses with the cycle can order them
+        for (auto i : schedule.next())
+          schedule.at(i)._idle();
+        schedule.advance();
       }
 
-      // Check for phase finish
+      for (O3_CPU& cpu : ooo_cpu)
+        for (std::size_t thread = 0; thread < std::size(cpu.threads); ++thread)
+          std::swap(pending.at(cpu.cpu).at(thread), cpu.threads[thread].input_queue);
+
       auto [elapsed_hour, elapsed_minute, elapsed_second] = elapsed_time();
       for (O3_CPU& cpu : ooo_cpu) {
-        // Phase complete
-        if (!phase_complete[cpu.cpu] && (cpu.sim_instr() >= length)) {
-          phase_complete[cpu.cpu] = true;
-          for (champsim::operable& op : operables)
-            op.end_phase(cpu.cpu);
-
-          std::cout << phase_name << " finished CPU " << cpu.cpu;
-          std::cout << " instructions: " << cpu.sim_instr() << " cycles: " << cpu.sim_cycle()
-                    << " cumulative IPC: " << std::ceil(cpu.sim_instr()) / std::ceil(cpu.sim_cycle());
-          std::cout << " (Simulation time: " << elapsed_hour << " hr " << elapsed_minute << " min " << elapsed_second << " sec) " << std::endl;
+        for (champsim::operable& op : operables)
+          op.end_phase(cpu.cpu);
+
+        std::cout << phase_name << " finished CPU " << cpu.cpu << " instructions: " << cpu.sim_instr() << " (functional)";
+        std::cout << " (Simulation time: " << elapsed_hour << " hr " << elapsed_minute << " min " << elapsed_second << " sec) " << std::endl;
+      }
+    } else if (engine) {
+      engine->run_phase(phase_name, length, refill);
+    } else {
+      std::vector<bool> phase_complete(std::size(ooo_cpu), false);
+      while (!std::accumulate(std::begin(phase_complete), std::end(phase_complete), true, std::logical_and{})) {
+        // Skip ahead, unless a core may still accept instructions from its trace
+        if (knob_skip_idle && std::all_of(std::cbegin(ooo_cpu), std::cend(ooo_cpu), input_full))
+          skip_idle_cycles(schedule);
+
+        // Operate
+        operate_cycle();
+
+        // Read from trace
+        for (O3_CPU& cpu : ooo_cpu)
+          refill(cpu);
+
+        // Check for phase finish
+        auto [elapsed_hour, elapsed_minute, elapsed_second] = elapsed_time();
+        for (O3_CPU& cpu : ooo_cpu) {
+          // Phase complete
+          if (!phase_complete[cpu.cpu] && (cpu.sim_instr() >= length)) {
+            phase_complete[cpu.cpu] = true;
+            for (champsim::operable& op : operables)
+              op.end_phase(cpu.cpu);
+
+            std::cout << phase_name << " finished CPU " << cpu.cpu;
+            std::cout << " instructions: " << cpu.sim_instr() << " cycles: " << cpu.sim_cycle()
+                      << " cumulative IPC: " << std::ceil(cpu.sim_instr()) / std::ceil(cpu.sim_cycle());
+            std::cout << " (Simulation time: " << elapsed_hour << " hr " << elapsed_minute << " min " << elapsed_second << " sec) " << std::endl;
+          }
         }
       }
     }
@@ -147,6 +336,13 @@ int champsim_main(std::vector<std::reference_wrapper<O3_CPU>>& ooo_cpu, std::vec
       std::cout << " (Simulation time: " << elapsed_hour << " hr " << elapsed_minute << " min " << elapsed_second << " sec) " << std::endl;
       std::cout << std::endl;
     }
+    champsim::end_host_profile_phase();
+
+    // Only the initial warmup is saved, not those between samples
+    if (is_warmup && !std::empty(checkpoint.save_path) && !checkpoint_saved) {
+      champsim::save_checkpoint(checkpoint.save_path, schedule.elapsed(), operables);
+      checkpoint_saved = true;
+    }
   }
 
   return 0;
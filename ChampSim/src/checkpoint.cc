@@ -0,0 +1,175 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "checkpoint.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#include "cache.h"
+#include "ooo_cpu.h"
+#include "ptw.h"
+#include "vmem.h"
+
+namespace
+{
+constexpr std::array<char, 8> CHECKPOINT_MAGIC = {'C', 'S', 'C', 'K', 'P', 'T', '0', '1'};
+
+std::map<const void*, std::vector<std::pair<std::string, std::function<void(champsim::checkpoint_archive&)>>>> registered_state;
+
+// Components are matched between configurations by name
+std::string section_name(champsim::operable& op)
+{
+  if (auto cpu = dynamic_cast<O3_CPU*>(&op); cpu != nullptr)
+    return "cpu" + std::to_string(cpu->cpu);
+  if (auto cache = dynamic_cast<CACHE*>(&op); cache != nullptr)
+    return cache->NAME;
+  if (auto ptw = dynamic_cast<PageTableWalker*>(&op); ptw != nullptr)
+    return ptw->NAME;
+  return {};
+}
+
+void serialize_component(champsim::operable& op, champsim::checkpoint_archive& ar)
+{
+  if (auto cpu = dynamic_cast<O3_CPU*>(&op); cpu != nullptr)
+    cpu->serialize(ar);
+  if (auto cache = dynamic_cast<CACHE*>(&op); cache != nullptr)
+    cache->serialize(ar);
+  if (auto ptw = dynamic_cast<PageTableWalker*>(&op); ptw != nullptr)
+    ptw->serialize(ar);
+}
+
+VirtualMemory* find_vmem(std::vector<std::reference_wrapper<champsim::operable>>& operables)
+{
+  for (champsim::operable& op : operables)
+    if (auto ptw = dynamic_cast<PageTableWalker*>(&op); ptw != nullptr)
+      return &ptw->vmem;
+  return nullptr;
+}
+
+// Every section that applies to the given operables, paired with the function that describes its contents
+std::vector<std::pair<std::string, std::function<void(champsim::checkpoint_archive&)>>>
+list_sections(std::vector<std::reference_wrapper<champsim::operable>>& operables)
+{
+  std::vector<std::pair<std::string, std::function<void(champsim::checkpoint_archive&)>>> retval;
+
+  if (auto vmem = find_vmem(operables); vmem != nullptr)
+    retval.emplace_back("vmem", [vmem](champsim::checkpoint_archive& ar) { vmem->serialize(ar); });
+
+  for (champsim::operable& op : operables) {
+    auto name = section_name(op);
+    if (std::empty(name))
+      continue;
+
+    retval.emplace_back(name, [&op](champsim::checkpoint_archive& ar) { serialize_component(op, ar); });
+    for (auto& [tag, func] : registered_state[dynamic_cast<const void*>(&op)])
+      retval.emplace_back(name + "/" + tag, func);
+  }
+
+  return retval;
+}
+} // namespace
+
+void champsim::checkpoint_archive::raw(void* data, std::size_t size)
+{
+  if (loading) {
+    if (position + size > std::size(buffer))
+      throw checkpoint_mismatch{"checkpoint section is truncated"};
+    std::memcpy(data, std::data(buffer) + position, size);
+  } else {
+    buffer.append(static_cast<const char*>(data), size);
+  }
+  position += size;
+}
+
+void champsim::register_checkpoint_function(const void* owner, std::string tag, std::function<void(checkpoint_archive&)> func)
+{
+  auto& owned = ::registered_state[owner];
+  auto found = std::find_if(std::begin(owned), std::end(owned), [&tag](const auto& x) { return x.first == tag; });
+  if (found != std::end(owned))
+    found->second = std::move(func);
+  else
+    owned.emplace_back(std::move(tag), std::move(func));
+}
+
+void champsim::save_checkpoint(const std::string& path, uint64_t elapsed_cycles, std::vector<std::reference_wrapper<operable>>& operables)
+{
+  std::map<std::string, std::string> sections;
+  for (auto& [name, func] : ::list_sections(operables)) {
+    checkpoint_archive ar{sections[name], false};
+    func(ar);
+  }
+
+  std::string contents;
+  checkpoint_archive file{contents, false};
+  auto magic = ::CHECKPOINT_MAGIC;
+  file.io(magic);
+  file.io(elapsed_cycles);
+  file.io(sections);
+
+  std::ofstream out{path, std::ios::binary};
+  out.write(std::data(contents), static_cast<std::streamsize>(std::size(contents)));
+  if (!out)
+    throw std::runtime_error("Could not write checkpoint " + path);
+
+  std::cout << "Saved checkpoint of " << std::size(sections) << " sections to " << path << std::endl;
+}
+
+uint64_t champsim::load_checkpoint(const std::string& path, std::vector<std::reference_wrapper<operable>>& operables)
+{
+  std::ifstream in{path, std::ios::binary};
+  if (!in)
+    throw std::runtime_error("Could not read checkpoint " + path);
+  std::string contents{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+
+  checkpoint_archive file{contents, true};
+  auto magic = ::CHECKPOINT_MAGIC;
+  file.io(magic);
+  if (magic != ::CHECKPOINT_MAGIC)
+    throw std::runtime_error(path + " is not a checkpoint");
+
+  uint64_t elapsed_cycles = 0;
+  std::map<std::string, std::string> sections;
+  file.io(elapsed_cycles);
+  file.io(sections);
+
+  // Components that are missing from the checkpoint, or do not match it, begin cold
+  std::size_t restored = 0, total = 0;
+  for (auto& [name, func] : ::list_sections(operables)) {
+    ++total;
+    auto found = sections.find(name);
+    if (found == std::end(sections)) {
+      std::cout << "Checkpoint " << path << " has no state for " << name << std::endl;
+      continue;
+    }
+
+    try {
+      checkpoint_archive ar{found->second, true};
+      func(ar);
+      if (!ar.finished())
+        throw checkpoint_mismatch{"checkpoint section is longer than expected"};
+      ++restored;
+    } catch (const checkpoint_mismatch& err) {
+      std::cout << "Checkpoint " << path << " does not match " << name << ": " << err.what() << std::endl;
+    }
+  }
+
+  std::cout << "Restored " << restored << " of " << total << " sections from checkpoint " << path << std::endl;
+  return elapsed_cycles;
+}
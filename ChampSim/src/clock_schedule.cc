@@ -0,0 +1,117 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "clock_schedule.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+// Longest repeating pattern we are willing to lay out, in cycles of the fastest clock
+constexpr uint64_t MAX_SCHEDULE_PERIOD = 1ull << 20;
+} // namespace
+
+champsim::clock_schedule::clock_schedule(std::vector<std::reference_wrapper<operable>> ops) : members(std::move(ops))
+{
+  uint64_t schedule_period = 1;
+  for (operable& op : members) {
+    auto [base, own] = op.CLOCK_SCALE;
+    assert(own > 0 && base >= own);
+    auto divisor = std::gcd(base, own);
+    ratios.push_back({base / divisor, own / divisor});
+
+    schedule_period = std::lcm(schedule_period, ratios.back().base_cycles);
+    if (schedule_period > MAX_SCHEDULE_PERIOD)
+      throw std::invalid_argument("The clock ratios repeat only after " + std::to_string(schedule_period) + " cycles, more than the "
+                                  + std::to_string(MAX_SCHEDULE_PERIOD) + " that a clock schedule can hold");
+  }
+
+  // A component that has operated k times over n cycles is ahead of the fastest clock by (k*base/own - n) cycles.
+  // It sits out a cycle whenever it is a full cycle ahead. The lead is kept scaled by own so that it stays integral.
+  std::vector<uint64_t> lead(std::size(members), 0);
+  auto less_ahead = [&](std::size_t lhs, std::size_t rhs) { return lead[lhs] * ratios[rhs].own_cycles < lead[rhs] * ratios[lhs].own_cycles; };
+
+  // The members are sorted after each cycle, with std::sort as the per-cycle sort this replaces, so that ties fall the same way.
+  // A tie keeps the order of the cycle before, so the order at the start of a period may take a few periods to settle.
+  std::vector<std::size_t> order(std::size(members));
+  std::iota(std::begin(order), std::end(order), 0);
+  std::vector<std::vector<std::size_t>> period_starts;
+  while (true) {
+    if (std::size(calendar) % schedule_period == 0) {
+      auto seen = std::find(std::begin(period_starts), std::end(period_starts), order);
+      if (seen == std::end(period_starts) && std::size(calendar) + schedule_period > MAX_SCHEDULE_PERIOD)
+        seen = std::prev(seen); // the order does not settle in time, so the last period repeats
+      if (seen != std::end(period_starts)) {
+        loop_start = static_cast<std::size_t>(std::distance(std::begin(period_starts), seen)) * schedule_period;
+        break;
+      }
+      period_starts.push_back(order);
+    }
+
+    auto& active = calendar.emplace_back();
+    for (auto i : order) {
+      if (lead[i] >= ratios[i].own_cycles)
+        lead[i] -= ratios[i].own_cycles;
+      else
+        active.push_back(i);
+    }
+
+    for (auto i : active)
+      lead[i] += ratios[i].base_cycles - ratios[i].own_cycles;
+    std::sort(std::begin(order), std::end(order), less_ahead);
+  }
+  operate_period = schedule_period;
+
+  position = index_of(elapsed());
+}
+
+std::size_t champsim::clock_schedule::index_of(uint64_t elapsed_cycles) const
+{
+  if (elapsed_cycles < std::size(calendar))
+    return static_cast<std::size_t>(elapsed_cycles);
+  return loop_start + static_cast<std::size_t>((elapsed_cycles - loop_start) % period());
+}
+
+uint64_t champsim::clock_schedule::elapsed() const
+{
+  uint64_t result = 0;
+  for (std::size_t i = 0; i < std::size(members); ++i) {
+    auto [base, own] = ratios[i];
+    result = std::max(result, (members[i].get().current_cycle * base + own - 1) / own);
+  }
+  return result;
+}
+
+void champsim::clock_schedule::seek(uint64_t elapsed_cycles)
+{
+  // Which members operate on a cycle repeats every operate_period cycles, whatever their order
+  std::vector<uint64_t> per_period(std::size(members), 0), partial(std::size(members), 0);
+  for (std::size_t cycle = 0; cycle < operate_period; ++cycle) {
+    for (auto i : calendar[cycle]) {
+      ++per_period[i];
+      if (cycle < elapsed_cycles % operate_period)
+        ++partial[i];
+    }
+  }
+
+  for (std::size_t i = 0; i < std::size(members); ++i)
+    members[i].get().current_cycle = (elapsed_cycles / operate_period) * per_period[i] + partial[i];
+  position = index_of(elapsed_cycles);
+}
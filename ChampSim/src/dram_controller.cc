@@ -31,7 +31,7 @@ uint64_t cycles(double time, int io_freq)
   return result < 0 ? 0 : static_cast<uint64_t>(result);
 }
 
-MEMORY_CONTROLLER::MEMORY_CONTROLLER(double freq_scale, int io_freq, double t_rp, double t_rcd, double t_cas, double turnaround)
+MEMORY_CONTROLLER::MEMORY_CONTROLLER(champsim::clock_ratio freq_scale, int io_freq, double t_rp, double t_rcd, double t_cas, double turnaround)
     : champsim::operable(freq_scale), tRP(cycles(t_rp / 1000, io_freq)), tRCD(cycles(t_rcd / 1000, io_freq)), tCAS(cycles(t_cas / 1000, io_freq)),
       DRAM_DBUS_TURN_AROUND_TIME(cycles(turnaround / 1000, io_freq)), DRAM_DBUS_RETURN_TIME(cycles(std::ceil(BLOCK_SIZE) / std::ceil(DRAM_CHANNEL_WIDTH), 1))
 {
@@ -156,6 +156,47 @@ void MEMORY_CONTROLLER::operate()
   }
 }
 
+uint64_t MEMORY_CONTROLLER::next_event_cycle() const
+{
+  uint64_t next = std::numeric_limits<uint64_t>::max();
+  for (const auto& channel : channels) {
+    auto valid = [](const auto& x) { return is_valid<PACKET>{}(x); };
+    auto unchecked = [](const auto& x) { return is_valid<PACKET>{}(x) && !x.forward_checked; };
+    auto wq_occu = static_cast<std::size_t>(std::count_if(std::begin(channel.WQ), std::end(channel.WQ), valid));
+    auto rq_occu = static_cast<std::size_t>(std::count_if(std::begin(channel.RQ), std::end(channel.RQ), valid));
+
+    // Warmup drains, collision checks, and mode changes all act immediately
+    if ((warmup && (wq_occu > 0 || rq_occu > 0)) || std::any_of(std::begin(channel.WQ), std::end(channel.WQ), unchecked)
+        || std::any_of(std::begin(channel.RQ), std::end(channel.RQ), unchecked))
+      return current_cycle;
+
+    if ((!channel.write_mode && (wq_occu >= DRAM_WRITE_HIGH_WM || (rq_occu == 0 && wq_occu > 0)))
+        || (channel.write_mode && (wq_occu == 0 || (rq_occu > 0 && wq_occu < DRAM_WRITE_LOW_WM))))
+      return current_cycle;
+
+    // Requests finishing or waiting for the bus
+    if (channel.active_request != std::end(channel.bank_request))
+      next = std::min(next, channel.active_request->event_cycle);
+    for (const auto& req : channel.bank_request)
+      if (req.valid)
+        next = std::min(next, req.event_cycle);
+
+    // The next packet that would be scheduled, if its bank is free
+    auto next_schedule = [](const auto& lhs, const auto& rhs) {
+      return !(rhs.address != 0 && !rhs.scheduled) || ((lhs.address != 0 && !lhs.scheduled) && lhs.event_cycle < rhs.event_cycle);
+    };
+    const auto& queue = channel.write_mode ? channel.WQ : channel.RQ;
+    auto iter_next_schedule = std::min_element(std::begin(queue), std::end(queue), next_schedule);
+    if (valid(*iter_next_schedule)) {
+      auto op_idx = dram_get_rank(iter_next_schedule->address) * DRAM_BANKS + dram_get_bank(iter_next_schedule->address);
+      if (!channel.bank_request[op_idx].valid)
+        next = std::min(next, iter_next_schedule->event_cycle);
+    }
+  }
+
+  return std::max(next, current_cycle);
+}
+
 void MEMORY_CONTROLLER::initialize()
 {
   long long int dram_size = DRAM_CHANNELS * DRAM_RANKS * DRAM_BANKS * DRAM_ROWS * DRAM_COLUMNS * BLOCK_SIZE / 1024 / 1024; // in MiB
@@ -273,31 +314,31 @@ bool MEMORY_CONTROLLER::add_pq(const PACKET& packet) { return add_rq(packet); }
  * offset |
  */
 
-uint32_t MEMORY_CONTROLLER::dram_get_channel(uint64_t address)
+uint32_t MEMORY_CONTROLLER::dram_get_channel(uint64_t address) const
 {
   int shift = LOG2_BLOCK_SIZE;
   return (address >> shift) & champsim::bitmask(champsim::lg2(DRAM_CHANNELS));
 }
 
-uint32_t MEMORY_CONTROLLER::dram_get_bank(uint64_t address)
+uint32_t MEMORY_CONTROLLER::dram_get_bank(uint64_t address) const
 {
   int shift = champsim::lg2(DRAM_CHANNELS) + LOG2_BLOCK_SIZE;
   return (address >> shift) & champsim::bitmask(champsim::lg2(DRAM_BANKS));
 }
 
-uint32_t MEMORY_CONTROLLER::dram_get_column(uint64_t address)
+uint32_t MEMORY_CONTROLLER::dram_get_column(uint64_t address) const
 {
   int shift = champsim::lg2(DRAM_BANKS) + champsim::lg2(DRAM_CHANNELS) + LOG2_BLOCK_SIZE;
   return (address >> shift) & champsim::bitmask(champsim::lg2(DRAM_COLUMNS));
 }
 
-uint32_t MEMORY_CONTROLLER::dram_get_rank(uint64_t address)
+uint32_t MEMORY_CONTROLLER::dram_get_rank(uint64_t address) const
 {
   int shift = champsim::lg2(DRAM_BANKS) + champsim::lg2(DRAM_COLUMNS) + champsim::lg2(DRAM_CHANNELS) + LOG2_BLOCK_SIZE;
   return (address >> shift) & champsim::bitmask(champsim::lg2(DRAM_RANKS));
 }
 
-uint32_t MEMORY_CONTROLLER::dram_get_row(uint64_t address)
+uint32_t MEMORY_CONTROLLER::dram_get_row(uint64_t address) const
 {
   int shift = champsim::lg2(DRAM_RANKS) + champsim::lg2(DRAM_BANKS) + champsim::lg2(DRAM_COLUMNS) + champsim::lg2(DRAM_CHANNELS) + LOG2_BLOCK_SIZE;
   return (address >> shift) & champsim::bitmask(champsim::lg2(DRAM_ROWS));
@@ -0,0 +1,244 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fanout.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <deque>
+#include <fcntl.h>
+#include <iostream>
+#include <memory>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "trace_source.h"
+
+namespace
+{
+constexpr std::size_t CHUNK_SIZE = 1 << 16;
+constexpr std::size_t MAX_CHUNKS_AHEAD = 64; // how far the fastest configuration may read ahead of the slowest
+
+// A trace file, read once and written to every configuration
+struct trace_stream {
+  std::string name;
+  std::unique_ptr<champsim::trace_source> source = champsim::open_trace_source(name);
+  std::deque<std::vector<char>> chunks; // read, but not yet written to every configuration
+  uint64_t first_chunk = 0;             // the position of chunks.front() in the stream
+
+  explicit trace_stream(std::string trace_name) : name(std::move(trace_name)) {}
+  uint64_t end_chunk() const { return first_chunk + std::size(chunks); }
+  bool read_chunk();
+};
+
+// How far along each stream a configuration has been given
+struct stream_pipe {
+  int fd;
+  uint64_t chunk = 0;
+  std::size_t offset = 0;
+};
+
+struct worker {
+  pid_t pid;
+  FILE* output;
+  std::vector<stream_pipe> pipes;
+  bool alive = true;
+
+  void retire()
+  {
+    for (auto& p : pipes)
+      close(p.fd);
+    alive = false;
+  }
+};
+
+// The configurations read the trace as if it were endless, so it is reopened here when it ends
+bool trace_stream::read_chunk()
+{
+  std::vector<char> buf(CHUNK_SIZE);
+  auto bytes_read = source->read(std::data(buf), std::size(buf));
+  if (bytes_read == 0) {
+    std::cout << "*** Reached end of trace: " << name << std::endl;
+    source = champsim::open_trace_source(name);
+    bytes_read = source->read(std::data(buf), std::size(buf));
+  }
+
+  if (bytes_read == 0)
+    return false;
+
+  buf.resize(bytes_read);
+  chunks.push_back(std::move(buf));
+  return true;
+}
+
+// Write to the configurations until all of them have exited. Returns false if a trace could not be read.
+bool feed(std::vector<trace_stream>& streams, std::vector<worker>& workers)
+{
+  auto is_alive = [](const worker& w) { return w.alive; };
+  while (std::any_of(std::cbegin(workers), std::cend(workers), is_alive)) {
+    // Every configuration is kept supplied, reading ahead for the fastest and holding chunks for the slowest.
+    // A configuration that is too far ahead is not polled, and so waits, until the slowest catches up.
+    std::vector<pollfd> polled;
+    std::vector<std::pair<worker*, std::size_t>> owners;
+    for (auto& w : workers) {
+      for (std::size_t i = 0; w.alive && i < std::size(streams); ++i) {
+        if (w.pipes[i].chunk == streams[i].end_chunk()) {
+          if (std::size(streams[i].chunks) >= MAX_CHUNKS_AHEAD)
+            continue;
+          if (!streams[i].read_chunk()) {
+            std::cerr << "Could not read trace " << streams[i].name << std::endl;
+            return false;
+          }
+        }
+        polled.push_back({w.pipes[i].fd, POLLOUT, 0});
+        owners.emplace_back(&w, i);
+      }
+    }
+
+    if (poll(std::data(polled), std::size(polled), -1) < 0 && errno != EINTR) {
+      std::perror("poll");
+      return false;
+    }
+
+    for (std::size_t k = 0; k < std::size(polled); ++k) {
+      auto [w, i] = owners[k];
+      if (!w->alive || polled[k].revents == 0)
+        continue;
+
+      // A configuration closes its streams when it completes
+      auto& pipe = w->pipes[i];
+      const auto& chunk = streams[i].chunks.at(pipe.chunk - streams[i].first_chunk);
+      auto written = (polled[k].revents & POLLOUT) ? write(pipe.fd, std::data(chunk) + pipe.offset, std::size(chunk) - pipe.offset) : -1;
+      if (written < 0) {
+        if (!(polled[k].revents & POLLOUT) || errno != EAGAIN)
+          w->retire();
+        continue;
+      }
+
+      pipe.offset += static_cast<std::size_t>(written);
+      if (pipe.offset == std::size(chunk)) {
+        ++pipe.chunk;
+        pipe.offset = 0;
+      }
+    }
+
+    for (std::size_t i = 0; i < std::size(streams); ++i) {
+      auto oldest = streams[i].end_chunk();
+      for (const auto& w : workers)
+        if (w.alive)
+          oldest = std::min(oldest, w.pipes[i].chunk);
+      for (; streams[i].first_chunk < oldest; ++streams[i].first_chunk)
+        streams[i].chunks.pop_front();
+    }
+  }
+
+  return true;
+}
+} // namespace
+
+int champsim::fanout_main(std::vector<environment>& environments, const std::vector<std::string>& trace_files,
+                          std::function<int(environment&, std::vector<std::string>)> run)
+{
+  // Every pipe exists before any configuration starts, so that each can close those that are not its own
+  std::vector<std::vector<std::array<int, 2>>> fds(std::size(environments), std::vector<std::array<int, 2>>(std::size(trace_files)));
+  for (auto& env_fds : fds) {
+    for (auto& p : env_fds) {
+      if (pipe(std::data(p)) != 0) {
+        std::perror("pipe");
+        return 1;
+      }
+    }
+  }
+
+  std::cout << std::flush;
+  std::fflush(stdout);
+
+  std::vector<::worker> workers;
+  for (std::size_t i = 0; i < std::size(environments); ++i) {
+    auto output = std::tmpfile();
+    auto pid = output == nullptr ? -1 : fork();
+    if (pid < 0) {
+      std::perror("fork");
+      for (auto& w : workers)
+        kill(w.pid, SIGKILL);
+      return 1;
+    }
+
+    if (pid == 0) {
+      std::vector<std::string> stream_names;
+      for (std::size_t j = 0; j < std::size(fds); ++j) {
+        for (auto [read_fd, write_fd] : fds[j]) {
+          close(write_fd);
+          if (j == i)
+            stream_names.push_back("/dev/fd/" + std::to_string(read_fd));
+          else
+            close(read_fd);
+        }
+      }
+
+      dup2(fileno(output), STDOUT_FILENO);
+      auto retval = run(environments[i], stream_names);
+      std::cout << std::flush;
+      std::fflush(stdout);
+      std::_Exit(retval);
+    }
+
+    workers.push_back({pid, output, {}});
+  }
+
+  for (std::size_t i = 0; i < std::size(workers); ++i) {
+    for (auto [read_fd, write_fd] : fds[i]) {
+      close(read_fd);
+      fcntl(write_fd, F_SETFL, fcntl(write_fd, F_GETFL) | O_NONBLOCK);
+      workers[i].pipes.push_back({write_fd});
+    }
+  }
+
+  std::signal(SIGPIPE, SIG_IGN);
+  std::vector<::trace_stream> streams;
+  for (const auto& name : trace_files)
+    streams.emplace_back(name);
+
+  auto retval = ::feed(streams, workers) ? 0 : 1;
+  for (auto& w : workers) {
+    if (retval != 0)
+      kill(w.pid, SIGKILL);
+    if (w.alive)
+      w.retire();
+  }
+
+  for (std::size_t i = 0; i < std::size(workers); ++i) {
+    int status = 0;
+    waitpid(workers[i].pid, &status, 0);
+
+    std::cout << std::endl << "*** Configuration " << environments[i].name << " ***" << std::endl;
+    std::rewind(workers[i].output);
+    std::array<char, 4096> buf;
+    for (auto n = std::fread(std::data(buf), 1, std::size(buf), workers[i].output); n > 0; n = std::fread(std::data(buf), 1, std::size(buf), workers[i].output))
+      std::cout.write(std::data(buf), static_cast<std::streamsize>(n));
+    std::fclose(workers[i].output);
+
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      std::cout << "*** Configuration " << environments[i].name << " did not complete" << std::endl;
+      retval = 1;
+    }
+  }
+
+  return retval;
+}
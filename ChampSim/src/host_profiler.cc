@@ -0,0 +1,85 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "host_profiler.h"
+
+#include <deque>
+
+namespace
+{
+struct registered_counter {
+  champsim::profile_counter counter;
+  const champsim::profile_counter* parent;
+};
+
+std::deque<registered_counter> counters; // a deque, so that registering does not move the others
+std::chrono::steady_clock::time_point phase_start;
+std::vector<champsim::host_profile> phases;
+
+// Each counter is followed by those nested within it
+void append_tree(std::vector<champsim::profile_counter>& out, const champsim::profile_counter* parent, std::size_t depth)
+{
+  for (const auto& [counter, counter_parent] : ::counters) {
+    if (counter_parent == parent) {
+      out.push_back(counter);
+      out.back().depth = depth;
+      append_tree(out, &counter, depth + 1);
+    }
+  }
+}
+
+std::chrono::steady_clock::duration timing_overhead()
+{
+  constexpr uint64_t CALIBRATION_CALLS = 100000;
+  champsim::profile_counter calibration;
+  for (uint64_t i = 0; i < CALIBRATION_CALLS; ++i)
+    champsim::profile_scope timer{&calibration};
+  return calibration.time / CALIBRATION_CALLS;
+}
+} // namespace
+
+bool champsim::host_profiling = false;
+
+champsim::profile_counter* champsim::register_profile_counter(std::string name, const profile_counter* parent)
+{
+  if (!host_profiling)
+    return nullptr;
+
+  ::counters.push_back({profile_counter{std::move(name)}, parent});
+  return &::counters.back().counter;
+}
+
+void champsim::begin_host_profile_phase()
+{
+  for (auto& [counter, parent] : ::counters) {
+    counter.calls = 0;
+    counter.time = {};
+  }
+  ::phase_start = std::chrono::steady_clock::now();
+}
+
+void champsim::end_host_profile_phase()
+{
+  host_profile profile;
+  if (host_profiling) {
+    profile.total = std::chrono::steady_clock::now() - ::phase_start;
+    ::append_tree(profile.counters, nullptr, 0);
+    profile.overhead = ::timing_overhead();
+  }
+  ::phases.push_back(std::move(profile));
+}
+
+const std::vector<champsim::host_profile>& champsim::host_profile_phases() { return ::phases; }
@@ -35,6 +35,15 @@ void champsim::json_printer::print(O3_CPU::stats_type stats)
   ++indent_level;
   stream << indent() << "\"instructions\": " << stats.instrs() << "," << std::endl;
   stream << indent() << "\"cycles\": " << stats.cycles() << "," << std::endl;
+  if (!std::empty(stats.end_thread_instrs)) {
+    stream << indent() << "\"threads\": [";
+    for (std::size_t i = 0; i < std::size(stats.end_thread_instrs); ++i) {
+      if (i != 0)
+        stream << ", ";
+      stream << "{\"instructions\": " << stats.thread_instrs(i) << ", \"branch mispredictions\": " << stats.thread_branch_misses.at(i) << "}";
+    }
+    stream << "]," << std::endl;
+  }
   stream << indent() << "\"Avg ROB occupancy at mispredict\": " << std::ceil(stats.total_rob_occupancy_at_branch_mispredict) / std::ceil(total_mispredictions)
          << ", " << std::endl;
 
@@ -211,11 +220,41 @@ void champsim::json_printer::print(champsim::phase_stats& stats)
   stream << std::endl;
 
   --indent_level;
-  stream << indent() << "}" << std::endl;
+  stream << indent() << "}";
+
+  if (!std::empty(stats.profile.counters)) {
+    stream << "," << std::endl;
+    print(stats.profile);
+  }
+  stream << std::endl;
+
   --indent_level;
   stream << indent() << "}" << std::endl;
 }
 
+void champsim::json_printer::print(const host_profile& profile)
+{
+  using seconds = std::chrono::duration<double>;
+
+  stream << indent() << "\"host profile\": {" << std::endl;
+  ++indent_level;
+  stream << indent() << "\"seconds\": " << seconds{profile.total}.count() << "," << std::endl;
+  stream << indent() << "\"overhead seconds per call\": " << seconds{profile.overhead}.count() << "," << std::endl;
+  stream << indent() << "\"counters\": [" << std::endl;
+  ++indent_level;
+
+  for (auto it = std::begin(profile.counters); it != std::end(profile.counters); ++it) {
+    stream << indent() << "{ \"name\": \"" << it->name << "\", \"depth\": " << it->depth << ", \"calls\": " << it->calls
+           << ", \"seconds\": " << seconds{it->time}.count() << " }";
+    stream << (std::next(it) != std::end(profile.counters) ? "," : "") << std::endl;
+  }
+
+  --indent_level;
+  stream << indent() << "]" << std::endl;
+  --indent_level;
+  stream << indent() << "}";
+}
+
 void champsim::json_printer::print(std::vector<phase_stats>& stats)
 {
   stream << "[" << std::endl;
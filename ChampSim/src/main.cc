@@ -16,40 +16,42 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <fstream>
 #include <functional>
 #include <getopt.h>
 #include <iostream>
 #include <signal.h>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "cache.h"
 #include "champsim.h"
+#include "checkpoint.h"
 #include "champsim_constants.h"
 #include "dram_controller.h"
+#include "environment.h"
+#include "fanout.h"
+#include "host_profiler.h"
 #include "ooo_cpu.h"
 #include "operable.h"
+#include "parallel_sim.h"
 #include "phase_info.h"
 #include "ptw.h"
+#include "sampling.h"
 #include "stats_printer.h"
+#include "trace_source.h"
 #include "util.h"
 #include "vmem.h"
 
-void init_structures();
-
 #include "core_inst.inc"
 
-uint64_t RETIRED_INSTRS;
-double STLB_MPKI;
+std::atomic<uint64_t> RETIRED_INSTRS;
+std::atomic<double> STLB_MPKI;
 
-#if defined(_MULTIPLE_PAGE_SIZE)
-int champsim_main(std::vector<std::reference_wrapper<O3_CPU>>& cpus, std::vector<std::reference_wrapper<champsim::operable>>& operables,
-                  std::vector<champsim::phase_info>& phases, bool knob_cloudsuite, std::vector<std::string> trace_names, std::vector<std::string> trace_ext_names);
-#else
 int champsim_main(std::vector<std::reference_wrapper<O3_CPU>>& cpus, std::vector<std::reference_wrapper<champsim::operable>>& operables,
-                  std::vector<champsim::phase_info>& phases, bool knob_cloudsuite, std::vector<std::string> trace_names);
-#endif
+                  std::vector<champsim::phase_info>& phases, bool knob_cloudsuite, bool knob_skip_idle, champsim::parallel_config parallel, champsim::checkpoint_config checkpoint, uint64_t skip_instructions, std::vector<std::string> trace_names);
 
 void signal_handler(int signal)
 {
@@ -77,9 +79,6 @@ std::vector<champsim::phase_stats> zip_phase_stats(const std::vector<champsim::p
 
       stats.name = phases.at(i).name;
       stats.trace_names = phases.at(i).trace_names;
-//#if defined(MULTIPLE_PAGE_SIZE)
-//			stats.trace_ext_names = phases.at(i).trace_ext_names;
-//#endif
 
       std::transform(std::begin(cpus), std::end(cpus), std::back_inserter(stats.sim_cpu_stats), [i](const O3_CPU& cpu) { return cpu.sim_stats.at(i); });
       std::transform(std::begin(cache_list), std::end(cache_list), std::back_inserter(stats.sim_cache_stats),
@@ -92,6 +91,9 @@ std::vector<champsim::phase_stats> zip_phase_stats(const std::vector<champsim::p
       std::transform(std::begin(dram.channels), std::end(dram.channels), std::back_inserter(stats.roi_dram_stats),
                      [i](const DRAM_CHANNEL& chan) { return chan.roi_stats.at(i); });
 
+      if (i < std::size(champsim::host_profile_phases()))
+        stats.profile = champsim::host_profile_phases().at(i);
+
 #if defined ENABLE_PTW_STATS
       std::transform(std::begin(ptw_list), std::end(ptw_list), std::back_inserter(stats.roi_ptw_stats),
                      [i](const PageTableWalker& ptw) { return ptw.roi_stats.at(i); });
@@ -114,23 +116,44 @@ int main(int argc, char** argv)
 
   // initialize knobs
   uint8_t knob_cloudsuite = 0;
-  uint64_t warmup_instructions = 1000000, simulation_instructions = 10000000;
+  uint64_t warmup_instructions = 1000000, simulation_instructions = 10000000, skip_instructions = 0;
   bool knob_json_out = false;
-  std::ofstream json_file;
+  std::string json_path;
+  bool knob_skip_idle = false;
+  bool knob_functional_warmup = false;
+  champsim::parallel_config parallel;
+  champsim::checkpoint_config checkpoint;
+  champsim::sampling_config sampling;
 
   // check to see if knobs changed using getopt_long()
   int traces_encountered = 0;
-  static struct option long_options[] = {{"warmup_instructions", required_argument, 0, 'w'},
+  static struct option long_options[] = {{"skip_instructions", required_argument, 0, 'n'},
+                                         {"warmup_instructions", required_argument, 0, 'w'},
                                          {"simulation_instructions", required_argument, 0, 'i'},
                                          {"hide_heartbeat", no_argument, 0, 'h'},
                                          {"cloudsuite", no_argument, 0, 'c'},
                                          {"json", optional_argument, 0, 'j'},
+                                         {"skip_idle_cycles", no_argument, 0, 's'},
+                                         {"functional_warmup", no_argument, 0, 'f'},
+                                         {"parallel_quantum", required_argument, 0, 'q'},
+                                         {"parallel_slack", required_argument, 0, 'k'},
+                                         {"save_checkpoint", required_argument, 0, 'v'},
+                                         {"load_checkpoint", required_argument, 0, 'l'},
+                                         {"sample_interval", required_argument, 0, 'u'},
+                                         {"sample_warmup", required_argument, 0, 'd'},
+                                         {"sample_length", required_argument, 0, 'm'},
+                                         {"profile_host", no_argument, 0, 'p'},
+                                         {"trace_decoder_threads", required_argument, 0, 'x'},
+                                         {"trace_server", required_argument, 0, 'r'},
                                          {"traces", no_argument, &traces_encountered, 1},
                                          {0, 0, 0, 0}};
 
   int c;
   while ((c = getopt_long_only(argc, argv, "w:i:hc", long_options, NULL)) != -1 && !traces_encountered) {
     switch (c) {
+    case 'n':
+      skip_instructions = atol(optarg);
+      break;
     case 'w':
       warmup_instructions = atol(optarg);
       break;
@@ -138,16 +161,53 @@ int main(int argc, char** argv)
       simulation_instructions = atol(optarg);
       break;
     case 'h':
-      for (O3_CPU& cpu : ooo_cpu)
-        cpu.show_heartbeat = false;
+      for (auto& env : environments)
+        for (O3_CPU& cpu : env.cpus)
+          cpu.show_heartbeat = false;
       break;
     case 'c':
       knob_cloudsuite = 1;
       break;
+    case 's':
+      knob_skip_idle = true;
+      break;
+    case 'f':
+      knob_functional_warmup = true;
+      break;
+    case 'q':
+      parallel.quantum = atol(optarg);
+      break;
+    case 'k':
+      parallel.slack = atol(optarg);
+      break;
+    case 'v':
+      checkpoint.save_path = optarg;
+      break;
+    case 'l':
+      checkpoint.load_path = optarg;
+      break;
+    case 'u':
+      sampling.interval = atol(optarg);
+      break;
+    case 'd':
+      sampling.warmup = atol(optarg);
+      break;
+    case 'm':
+      sampling.length = atol(optarg);
+      break;
+    case 'p':
+      champsim::host_profiling = true;
+      break;
+    case 'x':
+      champsim::trace_decoder_threads = static_cast<unsigned>(std::max(1l, atol(optarg)));
+      break;
+    case 'r':
+      champsim::trace_server_socket = optarg;
+      break;
     case 'j':
       knob_json_out = true;
       if (optarg)
-        json_file.open(optarg);
+        json_path = optarg;
     case 0:
       break;
     default:
@@ -155,36 +215,42 @@ int main(int argc, char** argv)
     }
   }
 
-#if defined(_MULTIPLE_PAGE_SIZE)
-  std::vector<std::string> _trace_names{std::next(argv, optind), std::next(argv, argc)};
-	std::vector<std::string> trace_names, trace_ext_names;
-	// need to get the extensions out of the list and into traces_ext_names
-	// also please learn to use loops or switch to a functional language, this is agonizing...
-	unsigned int traces_sep = _trace_names.size()/2;
-	assert(_trace_names.size() % 2 == 0);
-	for (unsigned int i = 0; i < _trace_names.size(); i++) {
-		if (i < traces_sep) {
-			trace_names.push_back(_trace_names[i]);
-		} else {
-			trace_ext_names.push_back(_trace_names[i]);
-		}	
-	}
-
-//  std::vector<champsim::phase_info> phases{{champsim::phase_info{"Warmup", true, warmup_instructions, trace_names, trace_ext_names},
-//                                            champsim::phase_info{"Simulation", false, simulation_instructions, trace_names, trace_ext_names}}};
-#else
   std::vector<std::string> trace_names{std::next(argv, optind), std::next(argv, argc)};
-#endif
 
 	std::vector<champsim::phase_info> phases{{champsim::phase_info{"Warmup", true, warmup_instructions, trace_names},
                                             champsim::phase_info{"Simulation", false, simulation_instructions, trace_names}}};
+  phases[0].is_functional = knob_functional_warmup;
+
+  // Sampling replaces the simulation phase with alternating fast-forwards and detailed windows
+  if (sampling.enabled()) {
+    try {
+      auto sampled = champsim::sampled_phases(sampling, simulation_instructions, trace_names);
+      phases.erase(std::next(std::begin(phases)), std::end(phases));
+      phases.insert(std::end(phases), std::begin(sampled), std::end(sampled));
+    } catch (const std::invalid_argument& err) {
+      std::cerr << err.what() << std::endl;
+      return 1;
+    }
+  }
 
   std::cout << std::endl;
   std::cout << "*** ChampSim Multicore Out-of-Order Simulator ***" << std::endl;
   std::cout << std::endl;
-  std::cout << "Warmup Instructions: " << phases[0].length << std::endl;
-  std::cout << "Simulation Instructions: " << phases[1].length << std::endl;
-  std::cout << "Number of CPUs: " << std::size(ooo_cpu) << std::endl;
+  if (skip_instructions > 0)
+    std::cout << "Skipped Instructions: " << skip_instructions << std::endl;
+  std::cout << "Warmup Instructions: " << phases[0].length << (phases[0].is_functional ? " (functional)" : "") << std::endl;
+  std::cout << "Simulation Instructions: " << simulation_instructions << std::endl;
+  if (sampling.enabled()) {
+    std::cout << "Sampling Interval: " << sampling.interval << " Detailed Warmup: " << sampling.warmup << " Measured: " << sampling.length;
+    std::cout << " Windows: " << simulation_instructions / sampling.interval << std::endl;
+  }
+  std::cout << "Number of CPUs: " << std::size(environments.front().cpus) << std::endl;
+  if (std::size(environments) > 1) {
+    std::cout << "Configurations:";
+    for (const auto& env : environments)
+      std::cout << " " << env.name;
+    std::cout << std::endl;
+  }
 #if defined(MULTIPLE_PAGE_SIZE)
   std::cout << "Small page size: " << PAGE_SIZE << std::endl;
   std::cout << "Large page size: " << LARGE_PAGE_SIZE << std::endl;
@@ -193,52 +259,64 @@ int main(int argc, char** argv)
 #endif
   std::cout << std::endl;
 
-  init_structures();
+  // A restored checkpoint stands in for the warmup
+  if (!std::empty(checkpoint.load_path))
+    phases.erase(std::begin(phases));
 
-#if defined(_MULTIPLE_PAGE_SIZE) 
-  champsim_main(ooo_cpu, operables, phases, knob_cloudsuite, trace_names, trace_ext_names);
-#else
-  champsim_main(ooo_cpu, operables, phases, knob_cloudsuite, trace_names);
-#endif
+  auto run = [&](champsim::environment& env, std::vector<std::string> trace_files) {
+    env.init_structures();
 
-  std::cout << std::endl;
-  std::cout << "ChampSim completed all CPUs" << std::endl;
-  std::cout << std::endl;
+    champsim_main(env.cpus, env.operables, phases, knob_cloudsuite, knob_skip_idle, parallel, checkpoint, skip_instructions, trace_files);
+
+    std::cout << std::endl;
+    std::cout << "ChampSim completed all CPUs" << std::endl;
+    std::cout << std::endl;
 
-	for (O3_CPU& cpu : ooo_cpu)
-		cpu.finalize();
+    for (O3_CPU& cpu : env.cpus)
+      cpu.finalize();
 
 #if defined ENABLE_PTW_STATS
-  auto phase_stats = zip_phase_stats(phases, ooo_cpu, caches, DRAM, ptws);
+    auto phase_stats = zip_phase_stats(phases, env.cpus, env.caches, env.dram.get(), env.ptws);
 #else
-  auto phase_stats = zip_phase_stats(phases, ooo_cpu, caches, DRAM);
+    auto phase_stats = zip_phase_stats(phases, env.cpus, env.caches, env.dram.get());
 #endif
-  champsim::plain_printer default_print{std::cout};
-  default_print.print(phase_stats);
+    if (sampling.enabled()) {
+      champsim::print_sampling_report(std::cout, phase_stats);
+    } else {
+      champsim::plain_printer default_print{std::cout};
+      default_print.print(phase_stats);
+    }
 
 #if defined ENABLE_EXTRA_CACHE_STATS
-  for (CACHE& cache : caches) {
-    cache.pageAddressStatsMon->dump();
-    cache.recallDistMon->dump();
-		delete cache.recallDistMon;
-	}
+    for (CACHE& cache : env.caches) {
+      cache.pageAddressStatsMon->dump();
+      cache.recallDistMon->dump();
+      delete cache.recallDistMon;
+    }
 #endif
 
-  for (CACHE& cache : caches)
-    cache.impl_prefetcher_final_stats();
+    for (CACHE& cache : env.caches)
+      cache.impl_prefetcher_final_stats();
 
-  for (CACHE& cache : caches)
-    cache.impl_replacement_final_stats();
+    for (CACHE& cache : env.caches)
+      cache.impl_replacement_final_stats();
 
-  if (knob_json_out) {
-    if (json_file.is_open()) {
+    // Each configuration of a fan-out writes a file of its own
+    if (knob_json_out && !std::empty(json_path)) {
+      std::ofstream json_file{std::empty(env.name) ? json_path : json_path + "." + env.name};
       champsim::json_printer printer{json_file};
       printer.print(phase_stats);
-    } else {
+    } else if (knob_json_out) {
       champsim::json_printer printer{std::cout};
       printer.print(phase_stats);
     }
-  }
 
-  return 0;
+    return 0;
+  };
+
+  std::vector<std::string> trace_files{trace_names};
+
+  if (std::size(environments) > 1)
+    return champsim::fanout_main(environments, trace_files, run);
+  return run(environments.front(), trace_files);
 }
@@ -17,12 +17,13 @@
 #include "ooo_cpu.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iterator>
 #include <numeric>
+#include <sstream>
 #include <utility>
 #include <vector>
-#include <sys/stat.h>
 
 #include "cache.h"
 #include "champsim.h"
@@ -30,61 +31,31 @@
 
 
 #if defined PTP_REPLACEMENT_POLICY
-extern uint64_t RETIRED_INSTRS;
-extern double STLB_MPKI;
+extern std::atomic<uint64_t> RETIRED_INSTRS;
+extern std::atomic<double> STLB_MPKI;
 #endif 
 
 constexpr uint64_t DEADLOCK_CYCLE = 1000000;
 
 std::tuple<uint64_t, uint64_t, uint64_t> elapsed_time();
 
-#if defined TRACK_BRANCH_HISTORY
-
-uint64_t global_path_history_MHRP = 0;
-uint64_t global_path_history = 0;
-uint64_t uncondIndHistory = 0;
-uint64_t condHistory = 0;
-uint64_t uncondIndHistory_old = 0;
-uint64_t condHistory_old = 0;
-
-int folding_factor=2;
-int glob_shifts_main = 4;
-int globe_bits_mask_main = 3;
-
-void update_history(uint64_t pc, uint64_t& hist) {
-	hist <<= 8;
-	uint64_t brh = hist;
-	hist = (brh | ((pc >> 2) & ((1 << 8) - 1)));
-}
-#endif 
-
-void update_path_history(uint64_t pc) {
-	uint64_t gph;
-	global_path_history <<= glob_shifts_main;
-	gph = global_path_history;
-	global_path_history = (gph | (((pc) & 7)));
-	global_path_history_MHRP <<= glob_shifts_main;
-	gph = global_path_history_MHRP;
-	global_path_history_MHRP = (gph | (((pc >> folding_factor) & globe_bits_mask_main)));
-}
-
 
 void O3_CPU::operate()
 {
-  retire_rob();                    // retire
-  complete_inflight_instruction(); // finalize execution
-  execute_instruction();           // execute instructions
-  schedule_instruction();          // schedule instructions
-  handle_memory_return();          // finalize memory transactions
-  operate_lsq();                   // execute memory transactions
+  champsim::profiled(stage_profile.retire_rob, [this] { retire_rob(); });                                       // retire
+  champsim::profiled(stage_profile.complete_inflight_instruction, [this] { complete_inflight_instruction(); }); // finalize execution
+  champsim::profiled(stage_profile.execute_instruction, [this] { execute_instruction(); });                     // execute instructions
+  champsim::profiled(stage_profile.schedule_instruction, [this] { schedule_instruction(); });                   // schedule instructions
+  champsim::profiled(stage_profile.handle_memory_return, [this] { handle_memory_return(); });                   // finalize memory transactions
+  champsim::profiled(stage_profile.operate_lsq, [this] { operate_lsq(); });                                     // execute memory transactions
 
-  dispatch_instruction(); // dispatch
-  decode_instruction();   // decode
-  promote_to_decode();
+  champsim::profiled(stage_profile.dispatch_instruction, [this] { dispatch_instruction(); }); // dispatch
+  champsim::profiled(stage_profile.decode_instruction, [this] { decode_instruction(); });     // decode
+  champsim::profiled(stage_profile.promote_to_decode, [this] { promote_to_decode(); });
 
-  fetch_instruction(); // fetch
-  check_dib();
-  initialize_instruction();
+  champsim::profiled(stage_profile.fetch_instruction, [this] { fetch_instruction(); }); // fetch
+  champsim::profiled(stage_profile.check_dib, [this] { check_dib(); });
+  champsim::profiled(stage_profile.initialize_instruction, [this] { initialize_instruction(); });
 
   // heartbeat
   if (show_heartbeat && (num_retired >= next_print_instruction)) {
@@ -96,10 +67,13 @@ void O3_CPU::operate()
     auto phase_instr{std::ceil(num_retired - begin_phase_instr)};
     auto phase_cycle{std::ceil(current_cycle - begin_phase_cycle)};
 
-    std::cout << "Heartbeat CPU " << cpu << " instructions: " << num_retired << " cycles: " << current_cycle;
-    std::cout << " heartbeat IPC: " << heartbeat_instr / heartbeat_cycle;
-    std::cout << " cumulative IPC: " << phase_instr / phase_cycle;
-    std::cout << " (Simulation time: " << elapsed_hour << " hr " << elapsed_minute << " min " << elapsed_second << " sec) " << std::endl;
+    // Built as one line, since cores may print concurrently
+    std::ostringstream line;
+    line << "Heartbeat CPU " << cpu << " instructions: " << num_retired << " cycles: " << current_cycle;
+    line << " heartbeat IPC: " << heartbeat_instr / heartbeat_cycle;
+    line << " cumulative IPC: " << phase_instr / phase_cycle;
+    line << " (Simulation time: " << elapsed_hour << " hr " << elapsed_minute << " min " << elapsed_second << " sec) " << std::endl;
+    std::cout << line.str() << std::flush;
     next_print_instruction += STAT_PRINTING_PERIOD;
 
     last_heartbeat_instr = num_retired;
@@ -115,13 +89,42 @@ void O3_CPU::operate()
 
 void O3_CPU::initialize()
 {
+  stage_profile.retire_rob = champsim::register_profile_counter("retire_rob", profile);
+  stage_profile.complete_inflight_instruction = champsim::register_profile_counter("complete_inflight_instruction", profile);
+  stage_profile.execute_instruction = champsim::register_profile_counter("execute_instruction", profile);
+  stage_profile.schedule_instruction = champsim::register_profile_counter("schedule_instruction", profile);
+  stage_profile.handle_memory_return = champsim::register_profile_counter("handle_memory_return", profile);
+  stage_profile.operate_lsq = champsim::register_profile_counter("operate_lsq", profile);
+  stage_profile.dispatch_instruction = champsim::register_profile_counter("dispatch_instruction", profile);
+  stage_profile.decode_instruction = champsim::register_profile_counter("decode_instruction", profile);
+  stage_profile.promote_to_decode = champsim::register_profile_counter("promote_to_decode", profile);
+  stage_profile.fetch_instruction = champsim::register_profile_counter("fetch_instruction", profile);
+  stage_profile.check_dib = champsim::register_profile_counter("check_dib", profile);
+  stage_profile.initialize_instruction = champsim::register_profile_counter("initialize_instruction", profile);
+#if defined(ENABLE_FDIP)
+  stage_profile.fdip_prefetch = champsim::register_profile_counter("FDIP prefetch", stage_profile.initialize_instruction);
+#endif
+
   // BRANCH PREDICTOR & BTB
   impl_initialize_branch_predictor();
   impl_initialize_btb();
 
 #if defined(MULTIPLE_PAGE_SIZE)
-	// init random number generator
-  srand((unsigned) time(NULL));
+	// A page size map fixes every page size ahead of the simulation
+	if (getenv("PAGE_SIZE_MAP_FILENAME")) {
+		std::cout << "Loading page size map from " << getenv("PAGE_SIZE_MAP_FILENAME") << std::endl;
+		page_map = std::make_shared<champsim::page_size_map>(getenv("PAGE_SIZE_MAP_FILENAME"));
+		code_page_sizes.use_map(page_map, true);
+		data_page_sizes.use_map(page_map, false);
+		std::cout << "\t" << page_map->num_code_regions() << " code and " << page_map->num_data_regions() << " data large pages" << std::endl;
+		return;
+	}
+
+	// Each core draws its random page sizes from generators of its own, for code and for data
+	uint64_t page_size_seed = getenv("PAGE_SIZE_SEED") ? std::stoull(getenv("PAGE_SIZE_SEED")) : 0;
+	std::cout << "Page size seed: " << page_size_seed << std::endl;
+	code_page_sizes.seed(page_size_seed, 2 * cpu);
+	data_page_sizes.seed(page_size_seed, 2 * cpu + 1);
 
 	if (getenv("INSTR_PAGE_SIZE_DIST")) {
 		INSTR_PAGE_SIZE_DIST = std::stoi(getenv("INSTR_PAGE_SIZE_DIST"));
@@ -130,36 +133,15 @@ void O3_CPU::initialize()
 		INSTR_PAGE_SIZE_DIST = 0;
 		std::cout << "Instruction page size distrubution: " << INSTR_PAGE_SIZE_DIST << std::endl;
 	}
+	code_page_sizes.set_large_page_dist(INSTR_PAGE_SIZE_DIST);
 
 	if (getenv("INSTR_PAGE_DIST_FILENAME")) { 
 
 		INSTR_PAGE_DIST_FILENAME = getenv("INSTR_PAGE_DIST_FILENAME");
 
 		std::cout << "Loading instruction page size distribution from " << INSTR_PAGE_DIST_FILENAME << std::endl;
-		std::ifstream instr_page_dist_file(INSTR_PAGE_DIST_FILENAME, std::ifstream::in);
-
-		// check if exist to load it, elese create it
-		struct stat sb;
- 		if (stat(INSTR_PAGE_DIST_FILENAME.c_str(), &sb) != 0) {
-		//if (!instr_page_dist_file) {
+		if (!code_page_sizes.load(INSTR_PAGE_DIST_FILENAME))
 			std::cout << "\tFile not found!" << std::endl;
-		} else {
-			std::string line; 
-			while (std::getline(instr_page_dist_file, line)) {
-				//std::cout << line << std::endl;
-				std::string _vpage = line.substr(0, line.find(":"));
-				std::string _page_size = line.substr(line.find(":") + 1, line.size());
-				//std::cout << "vpage(" << _vpage << "):page_size(" << _page_size << ")" << std::endl;
- 				uint64_t vpage;
-	   		std::istringstream _iss1(_vpage);
-    		_iss1 >> vpage;
- 				unsigned int page_size;
-	   		std::istringstream _iss2(_page_size);
-    		_iss2 >> page_size;
-				code_page_sizes[vpage] = page_size; 
-			}
-			instr_page_dist_file.close();
-		}
 	} else {
 		std::cerr << "ERROR: INSTR_PAGE_DIST_FILENAME not defined!" << std::endl;
 		exit(1);
@@ -173,70 +155,34 @@ void O3_CPU::initialize()
 		DATA_PAGE_SIZE_DIST = 0;
 		std::cout << "Data page size distrubution: " << DATA_PAGE_SIZE_DIST << std::endl;
 	}
+	data_page_sizes.set_large_page_dist(DATA_PAGE_SIZE_DIST);
 
 	if (getenv("DATA_PAGE_DIST_FILENAME")) { 
 
 		DATA_PAGE_DIST_FILENAME = getenv("DATA_PAGE_DIST_FILENAME");
 
 		std::cout << "Loading data page size distribution from " << DATA_PAGE_DIST_FILENAME << std::endl;
-		std::ifstream data_page_dist_file(DATA_PAGE_DIST_FILENAME, std::ifstream::in);
-
-		// check if exist to load it, elese create it
-		struct stat sb;
- 		if (stat(DATA_PAGE_DIST_FILENAME.c_str(), &sb) != 0) {
-		//if (!instr_page_dist_file) {
+		if (!data_page_sizes.load(DATA_PAGE_DIST_FILENAME))
 			std::cout << "\tFile not found!" << std::endl;
-		} else {
-			std::string line; 
-			while (std::getline(data_page_dist_file, line)) {
-				//std::cout << line << std::endl;
-				std::string _vpage = line.substr(0, line.find(":"));
-				std::string _page_size = line.substr(line.find(":") + 1, line.size());
-				//std::cout << "vpage(" << _vpage << "):page_size(" << _page_size << ")" << std::endl;
- 				uint64_t vpage;
-	   		std::istringstream _iss1(_vpage);
-    		_iss1 >> vpage;
- 				unsigned int page_size;
-	   		std::istringstream _iss2(_page_size);
-    		_iss2 >> page_size;
-				code_page_sizes[vpage] = page_size; 
-			}
-			data_page_dist_file.close();
-		}
 	} else {
 		std::cerr << "ERROR: DATA_PAGE_DIST_FILENAME not defined!" << std::endl;
 		exit(1);
 	}
 
 #endif
-/*
-#if defined(ENABLE_FDIP)
-	fdip = new FDIP(16);
-#endif
-*/
 }
 
 void O3_CPU::finalize()
 {
 #if defined(MULTIPLE_PAGE_SIZE)
+	if (page_map)
+		return;
 
-	std::ofstream instr_page_dist_file(INSTR_PAGE_DIST_FILENAME, std::ios_base::out);
 	std::cout << "Saving instructions large page distribution to " << INSTR_PAGE_DIST_FILENAME << "..." << std::endl;
-	for (auto it = code_page_sizes.begin(); it != code_page_sizes.end(); ++it) {
-		unsigned int page_size = (uint32_t)(it->second);
-		//std::cout << it->first << ":" << page_size << std::endl;
-		instr_page_dist_file << it->first << ":" << page_size << std::endl;	
-	}
-	instr_page_dist_file.close();
+	code_page_sizes.save(INSTR_PAGE_DIST_FILENAME);
 
-	std::ofstream data_page_dist_file(DATA_PAGE_DIST_FILENAME, std::ios_base::out);
 	std::cout << "Saving data large page distribution to " << DATA_PAGE_DIST_FILENAME << "..." << std::endl;
-	for (auto it = data_page_sizes.begin(); it != data_page_sizes.end(); ++it) {
-		unsigned int page_size = (uint32_t)(it->second);
-		//std::cout << it->first << ":" << page_size << std::endl;
-		data_page_dist_file << it->first << ":" << page_size << std::endl;	
-	}
-	data_page_dist_file.close();
+	data_page_sizes.save(DATA_PAGE_DIST_FILENAME);
 #endif
 }
 
@@ -250,6 +196,10 @@ void O3_CPU::begin_phase()
   stats.name = "CPU " + std::to_string(cpu);
   stats.begin_instrs = num_retired;
   stats.begin_cycles = current_cycle;
+  if (std::size(threads) > 1) {
+    std::transform(std::begin(threads), std::end(threads), std::back_inserter(stats.begin_thread_instrs), [](const auto& x) { return x.num_retired; });
+    stats.thread_branch_misses.resize(std::size(threads));
+  }
   sim_stats.push_back(stats);
 }
 
@@ -258,12 +208,16 @@ void O3_CPU::end_phase(unsigned finished_cpu)
   // Record where the phase ended (overwrite if this is later)
   sim_stats.back().end_instrs = num_retired;
   sim_stats.back().end_cycles = current_cycle;
+  if (std::size(threads) > 1) {
+    sim_stats.back().end_thread_instrs.clear();
+    std::transform(std::begin(threads), std::end(threads), std::back_inserter(sim_stats.back().end_thread_instrs), [](const auto& x) { return x.num_retired; });
+  }
 
 #if defined(MULTIPLE_PAGE_SIZE)
 	sim_stats.back().total_instr_large_pages = 0;
 	sim_stats.back().total_instr_small_pages = 0;
-	for (auto _it = code_page_sizes.begin(); _it != code_page_sizes.end(); ++_it) {
-		if (_it->second == 2)
+	for (auto [page, size] : code_page_sizes.entries()) {
+		if (size == 2)
 			sim_stats.back().total_instr_large_pages++;
 		else 
 			sim_stats.back().total_instr_small_pages++;
@@ -271,8 +225,8 @@ void O3_CPU::end_phase(unsigned finished_cpu)
 
 	sim_stats.back().total_data_large_pages = 0;
 	sim_stats.back().total_data_small_pages = 0;
-	for (auto _it = data_page_sizes.begin(); _it != data_page_sizes.end(); ++_it) {
-		if (_it->second == 2)
+	for (auto [page, size] : data_page_sizes.entries()) {
+		if (size == 2)
 			sim_stats.back().total_data_large_pages++;
 		else 
 			sim_stats.back().total_data_small_pages++;
@@ -287,62 +241,166 @@ void O3_CPU::end_phase(unsigned finished_cpu)
   }
 }
 
+std::size_t O3_CPU::select_fetch_thread() const
+{
+  // ICOUNT: the thread with the fewest instructions between fetch and execute, and among those the one that fetched least recently
+  auto selected = std::size(threads);
+  for (std::size_t i = 1; i <= std::size(threads); ++i) {
+    auto candidate = (last_fetch_thread + i) % std::size(threads);
+    const auto& thread = threads[candidate];
+    if (current_cycle >= thread.fetch_resume_cycle && fetchable(thread) > 0
+        && (selected == std::size(threads) || thread.icount < threads[selected].icount))
+      selected = candidate;
+  }
+  return selected;
+}
+
+std::size_t O3_CPU::fetchable(const hw_thread& thread) const
+{
+  // Fetch follows a decoupled branch prediction unit
+  if (decoupled_bpu())
+    return thread.predicted;
+  return std::size(thread.input_queue);
+}
+
+bool O3_CPU::decoupled_bpu() const
+{
+#if defined(ENABLE_FDIP)
+  return fdip.isDecoupled();
+#else
+  return false;
+#endif
+}
+
 void O3_CPU::initialize_instruction()
 {
   auto instrs_to_read_this_cycle = std::min(FETCH_WIDTH, static_cast<long>(IFETCH_BUFFER_SIZE - std::size(IFETCH_BUFFER)));
 
-  while (current_cycle >= fetch_resume_cycle && instrs_to_read_this_cycle > 0 && !std::empty(input_queue)) {
+  // One thread fetches in each cycle
+  auto fetch_thread = select_fetch_thread();
+  if (fetch_thread != std::size(threads))
+    last_fetch_thread = fetch_thread;
+
+  while (fetch_thread != std::size(threads) && instrs_to_read_this_cycle > 0 && fetchable(threads[fetch_thread]) > 0) {
+    auto& input_queue = threads[fetch_thread].input_queue;
     instrs_to_read_this_cycle--;
 
+    // The shared pipeline expects instructions in the order they were fetched
+    if (std::size(threads) > 1)
+      input_queue.front().instr_id = next_fetch_id++;
+
     auto stop_fetch = do_init_instruction(input_queue.front());
     if (stop_fetch)
       instrs_to_read_this_cycle = 0;
 
     // Add to IFETCH_BUFFER
-    IFETCH_BUFFER.push_back(input_queue.front());
+    IFETCH_BUFFER.push_back(std::move(input_queue.front()));
     input_queue.pop_front();
+    ++threads[fetch_thread].icount;
+    if (threads[fetch_thread].predicted > 0)
+      --threads[fetch_thread].predicted;
 
     IFETCH_BUFFER.back().event_cycle = current_cycle;
   }
 #if defined(ENABLE_FDIP)
-  std::deque<ooo_model_instr>* TARGET_BUFFER = &IFETCH_BUFFER;
+  champsim::profile_scope fdip_timer{stage_profile.fdip_prefetch};
   CACHE* TARGET_CACHE = static_cast<CACHE*>(L1I_bus.lower_level);
-  auto last_inst_id = fdip.getLastAddedInstr();
-  auto last_inst_addr = (std::begin(*TARGET_BUFFER));  
-  if (fdip.isEnabled()){
-    while ((last_inst_id >= last_inst_addr->instr_id) && 
-          (last_inst_addr != std::end(*TARGET_BUFFER))) last_inst_addr++;
-
-    for (; last_inst_addr != std::end(*TARGET_BUFFER); ++last_inst_addr){
-      fdip.push_back(last_inst_addr);
-    }
+  if (fdip.isDecoupled()) {
+    predict_ahead();
+  } else if (fdip.isEnabled()) {
+    // Queue the blocks of the instructions not yet seen, as far ahead of fetch as the run-ahead depth
+    auto run_ahead_end = std::next(std::begin(IFETCH_BUFFER), static_cast<long>(std::min(fdip.getRunAhead(), std::size(IFETCH_BUFFER))));
+    auto last_inst_addr = std::partition_point(std::begin(IFETCH_BUFFER), run_ahead_end,
+                                               [id = fdip.getLastAddedInstr()](const auto& x) { return x.instr_id <= id; });
+    while (last_inst_addr != run_ahead_end && fdip.push_back(last_inst_addr))
+      ++last_inst_addr;
+  }
 
-    fdip.prune();
+  if (fdip.isEnabled()) {
     // Prefetch
     uint32_t sent = 0;
     while ((!fdip.empty()) && ( sent < fdip.getAggresivity())) {
-      auto tuple = fdip.get_prefetch_line();
-      uint64_t pf_addr = tuple.first;
-      uint64_t instr_id = tuple.second;
+      uint64_t pf_addr = fdip.get_prefetch_line();
       // Do not prefetch if the ip is already inflight
-      if (std::end(IFETCH_BUFFER) == std::find_if(std::begin(IFETCH_BUFFER), std::end(IFETCH_BUFFER), [pf_addr] (auto x){
-        return ((x.fetched > 0) && ((x.ip >> LOG2_BLOCK_SIZE) == (pf_addr >> LOG2_BLOCK_SIZE)));
-      } ) ){   
-        if (TARGET_CACHE->prefetch_line(IFETCH_BUFFER.front().ip, 
-                                        IFETCH_BUFFER.front().ip, 
-                                        pf_addr, 
-                                        true, 
-                                        0)) {
-          fdip.issue_prefetch(instr_id, current_cycle);
-        }
+      if (!fdip.isFetched(pf_addr)) {
+        TARGET_CACHE->prefetch_line(pf_addr, true, 0);
         sent++;
-        
       }
     }
   }
 #endif
 }
 
+#if defined(ENABLE_FDIP)
+void O3_CPU::predict_ahead()
+{
+  // The branch prediction unit of each thread queues one block in each cycle
+  for (std::size_t i = 0; i < std::size(threads); ++i) {
+    auto& thread = threads[i];
+    if (!can_predict_ahead(thread))
+      continue;
+
+    // The instructions of the wrong path are not in the trace, so it is followed one block after another
+    if (thread.wrong_path) {
+      fdip.push_block(thread.wrong_path_ip, static_cast<uint8_t>(i), true);
+      thread.wrong_path_ip = ((thread.wrong_path_ip >> LOG2_BLOCK_SIZE) + 1) << LOG2_BLOCK_SIZE;
+      --thread.wrong_path_blocks;
+      continue;
+    }
+
+    // A block ends with its cache line, at a taken branch, or at a mispredicted branch
+    const auto limit = std::min(fdip.getRunAhead(), std::size(thread.input_queue));
+    const auto block_ip = thread.input_queue[thread.predicted].ip;
+    fdip.push_block(block_ip, static_cast<uint8_t>(i), false);
+    while (thread.predicted < limit && (thread.input_queue[thread.predicted].ip >> LOG2_BLOCK_SIZE) == (block_ip >> LOG2_BLOCK_SIZE)) {
+      auto& instr = thread.input_queue[thread.predicted++];
+      do_predict_branch(instr);
+      if (instr.is_branch && (instr.branch_mispredicted || instr.branch_taken))
+        break;
+    }
+  }
+}
+
+bool O3_CPU::can_predict_ahead(const hw_thread& thread) const
+{
+  if (fdip.full())
+    return false;
+  if (thread.wrong_path)
+    return thread.wrong_path_blocks > 0;
+  return thread.predicted < std::min(fdip.getRunAhead(), std::size(thread.input_queue));
+}
+#endif
+
+void O3_CPU::begin_wrong_path([[maybe_unused]] const ooo_model_instr& branch, [[maybe_unused]] uint64_t predicted_target)
+{
+#if defined(ENABLE_FDIP)
+  // The unit goes on from the predicted target, or the next block if the branch is predicted not taken, for a few blocks.
+  // Those are sequential, for want of the instructions of the wrong path, so the further they go the less likely they are to be fetched.
+  auto& thread = threads[branch.thread];
+  thread.wrong_path = true;
+  thread.wrong_path_ip = predicted_target != 0 ? predicted_target : ((branch.ip >> LOG2_BLOCK_SIZE) + 1) << LOG2_BLOCK_SIZE;
+  thread.wrong_path_blocks = std::min(fdip.getWrongPathBlocks(), fdip.getSize() / std::size(threads));
+#endif
+}
+
+void O3_CPU::resolve_branch([[maybe_unused]] uint8_t thread)
+{
+#if defined(ENABLE_FDIP)
+  if (threads[thread].wrong_path) {
+    threads[thread].wrong_path = false;
+    fdip.drop_wrong_path(thread);
+  }
+#endif
+}
+
+void O3_CPU::flush_prediction()
+{
+  for (std::size_t i = 0; i < std::size(threads); ++i) {
+    threads[i].predicted = 0;
+    resolve_branch(static_cast<uint8_t>(i));
+  }
+}
+
 namespace
 {
 void do_stack_pointer_folding(ooo_model_instr& arch_instr)
@@ -365,7 +423,7 @@ void do_stack_pointer_folding(ooo_model_instr& arch_instr)
 }
 } // namespace
 
-bool O3_CPU::do_predict_branch(ooo_model_instr& arch_instr)
+bool O3_CPU::do_predict_branch(ooo_model_instr& arch_instr, bool functional)
 {
   bool stop_fetch = false;
 
@@ -382,16 +440,23 @@ bool O3_CPU::do_predict_branch(ooo_model_instr& arch_instr)
                 << std::endl;
     }
 
-    // call code prefetcher every time the branch predictor is used
-    static_cast<CACHE*>(L1I_bus.lower_level)->impl_prefetcher_branch_operate(arch_instr.ip, arch_instr.branch_type, predicted_branch_target);
+    // call code prefetcher every time the branch predictor is used, unless the instruction is only executed functionally
+    if (!functional)
+      static_cast<CACHE*>(L1I_bus.lower_level)->impl_prefetcher_branch_operate(arch_instr.ip, arch_instr.branch_type, predicted_branch_target);
 
     if (predicted_branch_target != arch_instr.branch_target
         || (arch_instr.branch_type == BRANCH_CONDITIONAL
             && arch_instr.branch_taken != arch_instr.branch_prediction)) { // conditional branches are re-evaluated at decode when the target is computed
-      sim_stats.back().total_rob_occupancy_at_branch_mispredict += std::size(ROB);
+      sim_stats.back().total_rob_occupancy_at_branch_mispredict += rob_occupancy();
       sim_stats.back().branch_type_misses[arch_instr.branch_type]++;
+      if (std::size(threads) > 1)
+        sim_stats.back().thread_branch_misses.at(arch_instr.thread)++;
       if (!warmup) {
-        fetch_resume_cycle = std::numeric_limits<uint64_t>::max();
+        // A decoupled branch prediction unit runs ahead, and fetch stops only when it reaches the branch
+        if (decoupled_bpu())
+          begin_wrong_path(arch_instr, predicted_branch_target);
+        else
+          threads[arch_instr.thread].fetch_resume_cycle = std::numeric_limits<uint64_t>::max();
         stop_fetch = true;
         arch_instr.branch_mispredicted = 1;
       }
@@ -406,7 +471,7 @@ bool O3_CPU::do_predict_branch(ooo_model_instr& arch_instr)
   return stop_fetch;
 }
 
-bool O3_CPU::do_init_instruction(ooo_model_instr& arch_instr)
+bool O3_CPU::do_init_instruction(ooo_model_instr& arch_instr, bool functional)
 {
   // fast warmup eliminates register dependencies between instructions branch predictor, cache contents, and prefetchers are still warmed up
   if (warmup) {
@@ -417,18 +482,24 @@ bool O3_CPU::do_init_instruction(ooo_model_instr& arch_instr)
 #ifdef TRACK_BRANCH_HISTORY
 	if (arch_instr.is_branch) {
 		if (arch_instr.branch_type == BRANCH_INDIRECT) {
-			update_history(arch_instr.ip, uncondIndHistory);
+			champsim::branch_history::update_history(arch_instr.ip, branch_history.uncondIndHistory);
 		} else if (arch_instr.branch_type == BRANCH_CONDITIONAL) {
-			update_history(arch_instr.ip, condHistory);
+			champsim::branch_history::update_history(arch_instr.ip, branch_history.condHistory);
 		}
 	}
-	update_path_history(arch_instr.ip);
-	uncondIndHistory_old = uncondIndHistory;
-	condHistory_old = condHistory;
+	branch_history.update_path_history(arch_instr.ip);
+	branch_history.uncondIndHistory_old = branch_history.uncondIndHistory;
+	branch_history.condHistory_old = branch_history.condHistory;
 #endif
 
   ::do_stack_pointer_folding(arch_instr);
-  return do_predict_branch(arch_instr);
+  if (!decoupled_bpu() || functional)
+    return do_predict_branch(arch_instr, functional);
+
+  // Predicted already by the branch prediction unit
+  if (arch_instr.branch_mispredicted)
+    threads[arch_instr.thread].fetch_resume_cycle = std::numeric_limits<uint64_t>::max();
+  return arch_instr.is_branch && (arch_instr.branch_mispredicted || arch_instr.branch_taken);
 }
 
 void O3_CPU::check_dib()
@@ -445,6 +516,10 @@ void O3_CPU::do_check_dib(ooo_model_instr& instr)
   // Check DIB to see if we recently fetched this line
   if (auto dib_result = DIB.check_hit(instr.ip); dib_result) {
     // The cache line is in the L0, so we can mark this as complete
+#if defined(ENABLE_FDIP)
+    if (fdip.isEnabled() && !instr.fetched)
+      fdip.fetch_block(instr.ip, 1);
+#endif
     instr.fetched = COMPLETED;
 
     // Also mark it as decoded
@@ -477,14 +552,19 @@ void O3_CPU::fetch_instruction()
 
     // Issue to L1I
     auto success = do_fetch_instruction(l1i_req_begin, l1i_req_end);
-    if (success)
+    if (success) {
+#if defined(ENABLE_FDIP)
+      if (fdip.isEnabled())
+        fdip.fetch_block(l1i_req_begin->ip, static_cast<uint32_t>(std::count_if(l1i_req_begin, l1i_req_end, [](const auto& x) { return !x.fetched; })));
+#endif
       std::for_each(l1i_req_begin, l1i_req_end, [](auto& x) { x.fetched = INFLIGHT; });
+    }
 
     l1i_req_begin = std::find_if(l1i_req_end, std::end(IFETCH_BUFFER), fetch_ready);
   }
 }
 
-bool O3_CPU::do_fetch_instruction(std::deque<ooo_model_instr>::iterator begin, std::deque<ooo_model_instr>::iterator end)
+bool O3_CPU::do_fetch_instruction(champsim::instr_queue::iterator begin, champsim::instr_queue::iterator end)
 {
   PACKET fetch_packet;
   fetch_packet.v_address = begin->ip;
@@ -497,40 +577,9 @@ bool O3_CPU::do_fetch_instruction(std::deque<ooo_model_instr>::iterator begin, s
 #endif
 
 #if defined(MULTIPLE_PAGE_SIZE) 
-	
-	uint64_t ip = begin->ip;
-	uint8_t page_size = 0;
-	bool ip_found = false;
-  // first search large pages
-  auto ip_it = code_page_sizes.find(ip >> 21);
-  if (ip_it != code_page_sizes.end()) {
-    page_size = code_page_sizes[ip >> 21];
-    ip_found = true;
-  }
-
-  ip_it = code_page_sizes.find(ip >> 12);
-  if (ip_it != code_page_sizes.end()) {
-    page_size = code_page_sizes[ip >> 12];
-    ip_found = true;
-  }
-
-  // if not found we have a new entry, decide page size with 10% probability.
-  if (!ip_found) {
-    uint64_t probability = rand() % 100;
-    if (probability < INSTR_PAGE_SIZE_DIST) {
-      page_size = 2;
-      code_page_sizes[ip >> 21] = 2;
-    } else {
-      page_size = 1;
-      code_page_sizes[ip >> 12] = 1;
-    }
-  }
-
-	fetch_packet.page_size = page_size; //PAGE_SIZE;
-	if (page_size == 2)
-		fetch_packet.base_vpn = begin->ip >> 21;
-	else 
-		fetch_packet.base_vpn = begin->ip >> 12;
+	auto [page_size, base_vpn] = lookup_page_size(true, begin->ip, begin->ip_page());
+	fetch_packet.page_size = page_size;
+	fetch_packet.base_vpn = base_vpn;
 #endif
 
   if constexpr (champsim::debug_print) {
@@ -549,6 +598,10 @@ void O3_CPU::promote_to_decode()
                                                          [cycle = current_cycle](const auto& x) { return x.fetched == COMPLETED && x.event_cycle <= cycle; });
   std::for_each(window_begin, window_end,
                 [cycle = current_cycle, lat = DECODE_LATENCY, warmup = warmup](auto& x) { return x.event_cycle = cycle + ((warmup || x.decoded) ? 0 : lat); });
+#if defined(ENABLE_FDIP)
+  if (fdip.isEnabled())
+    std::for_each(window_begin, window_end, [this](const auto& x) { fdip.release_block(x.ip); });
+#endif
   std::move(window_begin, window_end, std::back_inserter(DECODE_BUFFER));
   IFETCH_BUFFER.erase(window_begin, window_end);
 
@@ -575,7 +628,8 @@ void O3_CPU::decode_instruction()
         // clear the branch_mispredicted bit so we don't attempt to resume fetch again at execute
         db_entry.branch_mispredicted = 0;
         // pay misprediction penalty
-        this->fetch_resume_cycle = this->current_cycle + BRANCH_MISPREDICT_PENALTY;
+        this->threads[db_entry.thread].fetch_resume_cycle = this->current_cycle + BRANCH_MISPREDICT_PENALTY;
+        this->resolve_branch(db_entry.thread);
       }
     }
 
@@ -598,10 +652,9 @@ void O3_CPU::dispatch_instruction()
   std::size_t available_dispatch_bandwidth = DISPATCH_WIDTH;
 
   // dispatch DISPATCH_WIDTH instructions into the ROB
-  while (available_dispatch_bandwidth > 0 && !std::empty(DISPATCH_BUFFER) && DISPATCH_BUFFER.front().event_cycle < current_cycle && std::size(ROB) != ROB_SIZE
-         && ((std::size_t)std::count_if(std::begin(LQ), std::end(LQ), std::not_fn(is_valid<decltype(LQ)::value_type>{}))
-             >= std::size(DISPATCH_BUFFER.front().source_memory))
-         && ((std::size(DISPATCH_BUFFER.front().destination_memory) + std::size(SQ)) <= SQ_SIZE)) {
+  while (available_dispatch_bandwidth > 0 && !std::empty(DISPATCH_BUFFER) && DISPATCH_BUFFER.front().event_cycle < current_cycle
+         && can_dispatch(DISPATCH_BUFFER.front())) {
+    ++threads[DISPATCH_BUFFER.front().thread].rob_occupancy;
     ROB.push_back(std::move(DISPATCH_BUFFER.front()));
     DISPATCH_BUFFER.pop_front();
     do_memory_scheduling(ROB.back());
@@ -614,50 +667,90 @@ void O3_CPU::dispatch_instruction()
     throw champsim::deadlock{cpu};
 }
 
+std::size_t O3_CPU::rob_occupancy() const
+{
+  return std::accumulate(std::begin(threads), std::end(threads), std::size_t{}, [](auto acc, const auto& x) { return acc + x.rob_occupancy; });
+}
+
+bool O3_CPU::can_dispatch(const ooo_model_instr& instr) const
+{
+  auto loads = std::size(instr.source_memory);
+  auto stores = std::size(instr.destination_memory);
+  if (rob_occupancy() >= ROB_SIZE || std::size(lq_free) < loads || stores + std::size(SQ) > SQ_SIZE)
+    return false;
+  if (!SMT_PARTITIONED || std::size(threads) == 1)
+    return true;
+
+  // Each thread is held to its share of the entries
+  auto share = std::size(threads);
+  const auto& thread = threads[instr.thread];
+  return thread.rob_occupancy < ROB_SIZE / share && thread.lq_occupancy + loads <= std::size(LQ) / share && thread.sq_occupancy + stores <= SQ_SIZE / share;
+}
+
 void O3_CPU::schedule_instruction()
 {
-  auto search_bw = SCHEDULER_SIZE;
-  for (auto rob_it = std::begin(ROB); rob_it != std::end(ROB) && search_bw > 0; ++rob_it) {
-    if (rob_it->scheduled == 0)
-      do_scheduling(*rob_it);
+  // Instructions are scheduled in order, so those scheduled are a prefix of the ROB.
+  // The scheduler holds SCHEDULER_SIZE of them that have not yet executed.
+  while (num_scheduled < std::size(ROB) && scheduler_occupancy < static_cast<std::size_t>(SCHEDULER_SIZE) && can_rename(ROB[num_scheduled]))
+    do_scheduling(ROB[num_scheduled++]);
+}
+
+bool O3_CPU::can_rename(const ooo_model_instr& instr) const { return std::size(instr.destination_registers) <= std::size(phys_reg_free); }
 
-    if (rob_it->executed == 0)
-      --search_bw;
+void O3_CPU::wake_up(wakeup_queue& waiting, ready_queue& ready)
+{
+  while (!std::empty(waiting) && waiting.top()->event_cycle <= current_cycle) {
+    ready.push(waiting.top());
+    waiting.pop();
   }
 }
 
 void O3_CPU::do_scheduling(ooo_model_instr& instr)
 {
-  // Mark register dependencies
+  auto& rename_table = threads[instr.thread].rename_table;
+
+  // Mark register dependencies on the last writers of the sources that have yet to complete
   for (auto src_reg : instr.source_registers) {
-    if (!std::empty(reg_producers[src_reg])) {
-      ooo_model_instr& prior = reg_producers[src_reg].back();
-      if (prior.registers_instrs_depend_on_me.empty() || prior.registers_instrs_depend_on_me.back().get().instr_id != instr.instr_id) {
-        prior.registers_instrs_depend_on_me.push_back(instr);
-        instr.num_reg_dependent++;
-      }
+    auto phys_reg = rename_table[src_reg];
+    if (phys_reg == NO_PHYS_REG || phys_reg_producer[phys_reg] == nullptr)
+      continue;
+
+    ooo_model_instr& prior = *phys_reg_producer[phys_reg];
+    if (prior.first_dependent == NO_DEPENDENT || dependence_pool[prior.first_dependent].consumer != &instr) {
+      assert(!std::empty(dependence_free));
+      auto link = dependence_free.back();
+      dependence_free.pop_back();
+      dependence_pool[link] = {&instr, prior.first_dependent};
+      prior.first_dependent = link;
+      instr.num_reg_dependent++;
     }
   }
 
+  // Rename the destinations
   for (auto dreg : instr.destination_registers) {
-    auto begin = std::begin(reg_producers[dreg]);
-    auto end = std::end(reg_producers[dreg]);
-    auto ins = std::lower_bound(begin, end, instr, [](const ooo_model_instr& lhs, const ooo_model_instr& rhs) { return lhs.instr_id < rhs.instr_id; });
-    reg_producers[dreg].insert(ins, std::ref(instr));
+    auto phys_reg = phys_reg_free.back();
+    phys_reg_free.pop_back();
+    phys_reg_producer[phys_reg] = &instr;
+    instr.destination_phys_regs.push_back(phys_reg);
+    instr.replaced_phys_regs.push_back(rename_table[dreg]);
+    rename_table[dreg] = phys_reg;
   }
 
   instr.scheduled = COMPLETED;
   instr.event_cycle = current_cycle + (warmup ? 0 : SCHEDULING_LATENCY);
+  ++scheduler_occupancy;
+  if (instr.num_reg_dependent == 0)
+    execute_wakeup.push(&instr);
 }
 
 void O3_CPU::execute_instruction()
 {
-  auto exec_bw = EXEC_WIDTH;
-  for (auto rob_it = std::begin(ROB); rob_it != std::end(ROB) && exec_bw > 0; ++rob_it) {
-    if (rob_it->scheduled == COMPLETED && rob_it->executed == 0 && rob_it->num_reg_dependent == 0 && rob_it->event_cycle <= current_cycle) {
-      do_execution(*rob_it);
-      --exec_bw;
-    }
+  // The oldest instructions whose operands are ready
+  wake_up(execute_wakeup, execute_ready);
+  for (auto exec_bw = EXEC_WIDTH; exec_bw > 0 && !std::empty(execute_ready); --exec_bw) {
+    auto next = execute_ready.top();
+    execute_ready.pop();
+    do_execution(*next);
   }
 }
 
@@ -665,16 +758,20 @@ void O3_CPU::do_execution(ooo_model_instr& rob_entry)
 {
   rob_entry.executed = INFLIGHT;
   rob_entry.event_cycle = current_cycle + (warmup ? 0 : EXEC_LATENCY);
+  --threads[rob_entry.thread].icount;
+  --scheduler_occupancy;
+  if (rob_entry.completed_mem_ops == rob_entry.num_mem_ops())
+    complete_wakeup.push(&rob_entry);
 
-  // Mark LQ entries as ready to translate
-  for (auto& lq_entry : LQ)
-    if (lq_entry.has_value() && lq_entry->instr_id == rob_entry.instr_id)
-      lq_entry->event_cycle = current_cycle + (warmup ? 0 : EXEC_LATENCY);
+  // Mark LQ entries as ready to translate. An entry may since have been freed, or given to another instruction.
+  for (auto idx : rob_entry.lq_index)
+    if (LQ[idx].has_value() && LQ[idx]->instr_id == rob_entry.instr_id)
+      LQ[idx]->event_cycle = current_cycle + (warmup ? 0 : EXEC_LATENCY);
 
-  // Mark SQ entries as ready to translate
-  for (auto& sq_entry : SQ)
-    if (sq_entry.instr_id == rob_entry.instr_id)
-      sq_entry.event_cycle = current_cycle + (warmup ? 0 : EXEC_LATENCY);
+  // Mark SQ entries as ready to translate. The SQ is in program order.
+  auto sq_entry = std::partition_point(std::begin(SQ), std::end(SQ), [id = rob_entry.instr_id](const auto& x) { return x.instr_id < id; });
+  for (; sq_entry != std::end(SQ) && sq_entry->instr_id == rob_entry.instr_id; ++sq_entry)
+    sq_entry->event_cycle = current_cycle + (warmup ? 0 : EXEC_LATENCY);
 
   if constexpr (champsim::debug_print) {
     std::cout << "[ROB] " << __func__ << " instr_id: " << rob_entry.instr_id << " event_cycle: " << rob_entry.event_cycle << std::endl;
@@ -684,66 +781,28 @@ void O3_CPU::do_execution(ooo_model_instr& rob_entry)
 void O3_CPU::do_memory_scheduling(ooo_model_instr& instr)
 {
   // load
-#if defined(MULTIPLE_PAGE_SIZE)
-/*
-	std::cout << "checkpoint1.0" << std::endl;
-	auto page_size_src = std::begin(instr.page_size_source);
-	std::cout << "checkpoint1.1" << std::endl;
-	auto base_vpn_src = std::begin(instr.base_vpn_source);
-	std::cout << "checkpoint1.2" << std::endl;
-*/
-#endif
   for (auto& smem : instr.source_memory) {
-    auto q_entry = std::find_if_not(std::begin(LQ), std::end(LQ), is_valid<decltype(LQ)::value_type>{});
-    assert(q_entry != std::end(LQ));
+    auto q_entry = &allocate_lq(instr.thread);
 #if defined(MULTIPLE_PAGE_SIZE)
-		uint64_t addr = smem;
-		uint8_t page_size = 0;
-		uint64_t base_vpn = 0;
-		bool addr_found = false;
-  	// first search large pages
-  	auto addr_it = data_page_sizes.find(addr >> 21);
-  	if (addr_it != data_page_sizes.end()) {
-    	page_size = data_page_sizes[addr >> 21];
-    	addr_found = true;
-  	}
-
-  	addr_it = data_page_sizes.find(addr >> 12);
-  	if (addr_it != data_page_sizes.end()) {
-    	page_size = data_page_sizes[addr >> 12];
-    	addr_found = true;
-  	}
-
- 	 	// if not found we have a new entry, decide page size with 10% probability.
-  	if (!addr_found) {
-    	uint64_t probability = rand() % 100;
-    	if (probability < DATA_PAGE_SIZE_DIST) {
-      	page_size = 2;
-      	data_page_sizes[addr >> 21] = 2;
-    	} else {
-      	page_size = 1;
-      	data_page_sizes[addr >> 12] = 1;
-    	}
-  	}
-
-		if (page_size == 2)
-			base_vpn = addr >> 21;
-		else 
-			base_vpn = addr >> 12;
-
-    //q_entry->emplace(instr.instr_id, smem, instr.ip, instr.asid, *page_size_src++, *base_vpn_src++); // add it to the load queue
+		auto [page_size, base_vpn] = lookup_page_size(false, smem,
+		                                              instr.source_page(static_cast<std::size_t>(&smem - std::data(instr.source_memory))));
     q_entry->emplace(instr.instr_id, smem, instr.ip, instr.asid, page_size, base_vpn); // add it to the load queue
-		//std::cout << "checkpoint2" << std::endl;
 #else
     q_entry->emplace(instr.instr_id, smem, instr.ip, instr.asid); // add it to the load queue
 #endif
-    // Check for forwarding
-    auto sq_it = std::max_element(std::begin(SQ), std::end(SQ), [smem](const auto& lhs, const auto& rhs) {
-      return lhs.virtual_address != smem || (rhs.virtual_address == smem && lhs.instr_id < rhs.instr_id);
-    });
-    if (sq_it != std::end(SQ) && sq_it->virtual_address == smem) {
+    (*q_entry)->thread = instr.thread;
+    instr.lq_index.push_back(static_cast<uint32_t>(q_entry - std::data(LQ)));
+
+    // Check for forwarding from the youngest store to this address
+    auto sq_it = std::end(SQ);
+    if (auto found = sq_by_address.find(smem); found != std::end(sq_by_address)) {
+      sq_it = std::partition_point(std::begin(SQ), std::end(SQ), [id = found->second.youngest_id](const auto& x) { return x.instr_id < id; });
+      while (sq_it->virtual_address != smem) // the store may write to several addresses
+        ++sq_it;
+    }
+    if (sq_it != std::end(SQ)) {
       if (sq_it->fetch_issued) { // Store already executed
-        q_entry->reset();
+        release_lq(*q_entry);
         ++instr.completed_mem_ops;
 
         if constexpr (champsim::debug_print)
@@ -760,55 +819,13 @@ void O3_CPU::do_memory_scheduling(ooo_model_instr& instr)
   }
 
   // store
-#if defined(MULTIPLE_PAGE_SIZE)
-/*
-	auto page_size_dst = std::begin(instr.page_size_destination);
-	std::cout << "checkpoint3.1" << std::endl;
-	auto base_vpn_dst = std::begin(instr.base_vpn_destination);	
-	std::cout << "checkpoint3.2" << std::endl;
-*/
-#endif
   for (auto& dmem : instr.destination_memory) {
 #if defined(MULTIPLE_PAGE_SIZE)
-		uint64_t addr = dmem;
-		uint8_t page_size = 0;
-		uint64_t base_vpn = 0;
-		bool addr_found = false;
-  	// first search large pages
-  	auto addr_it = data_page_sizes.find(addr >> 21);
-  	if (addr_it != data_page_sizes.end()) {
-    	page_size = data_page_sizes[addr >> 21];
-    	addr_found = true;
-  	}
-
-  	addr_it = data_page_sizes.find(addr >> 12);
-  	if (addr_it != data_page_sizes.end()) {
-    	page_size = data_page_sizes[addr >> 12];
-    	addr_found = true;
-  	}
-
- 	 	// if not found we have a new entry, decide page size with 10% probability.
-  	if (!addr_found) {
-    	uint64_t probability = rand() % 100;
-    	if (probability < DATA_PAGE_SIZE_DIST) {
-      	page_size = 2;
-      	data_page_sizes[addr >> 21] = 2;
-    	} else {
-      	page_size = 1;
-      	data_page_sizes[addr >> 12] = 1;
-    	}
-  	}
-
-		if (page_size == 2)
-			base_vpn = addr >> 21;
-		else 
-			base_vpn = addr >> 12;
-
-    //SQ.emplace_back(instr.instr_id, dmem, instr.ip, instr.asid, *page_size_dst++, *base_vpn_dst++); // add it to the store queue
-    SQ.emplace_back(instr.instr_id, dmem, instr.ip, instr.asid, page_size, base_vpn); // add it to the store queue
-		//std::cout << "checkpoint4" << std::endl;
+		auto [page_size, base_vpn] = lookup_page_size(false, dmem,
+		                                              instr.destination_page(static_cast<std::size_t>(&dmem - std::data(instr.destination_memory))));
+    allocate_sq(instr.thread, {instr.instr_id, dmem, instr.ip, instr.asid, page_size, base_vpn}); // add it to the store queue
 #else
-    SQ.emplace_back(instr.instr_id, dmem, instr.ip, instr.asid); // add it to the store queue
+    allocate_sq(instr.thread, {instr.instr_id, dmem, instr.ip, instr.asid}); // add it to the store queue
 #endif
 	}
   if constexpr (champsim::debug_print) {
@@ -821,24 +838,44 @@ void O3_CPU::operate_lsq()
 {
   auto store_bw = SQ_WIDTH;
 
-  const auto complete_id = std::empty(ROB) ? std::numeric_limits<uint64_t>::max() : ROB.front().instr_id;
-  auto do_complete = [cycle = current_cycle, complete_id, this](const auto& x) {
-    return x.instr_id < complete_id && x.event_cycle <= cycle && this->do_complete_store(x);
-  };
+  // Stores execute, and are written once they retire, in order within each thread
+  const auto all_threads = (1u << std::size(threads)) - 1;
+  unsigned blocked = 0;
+  for (auto it = std::find_if_not(std::begin(SQ), std::end(SQ), [](const auto& x) { return x.fetch_issued; });
+       it != std::end(SQ) && store_bw > 0 && blocked != all_threads; ++it) {
+    if (it->fetch_issued || (blocked & (1u << it->thread)))
+      continue;
+    if (it->event_cycle > current_cycle) {
+      blocked |= 1u << it->thread;
+      continue;
+    }
 
-  auto unfetched_begin = std::partition_point(std::begin(SQ), std::end(SQ), [](const auto& x) { return x.fetch_issued; });
-  auto [fetch_begin, fetch_end] = champsim::get_span_p(unfetched_begin, std::end(SQ), store_bw,
-                                                       [cycle = current_cycle](const auto& x) { return !x.fetch_issued && x.event_cycle <= cycle; });
-  store_bw -= std::distance(fetch_begin, fetch_end);
-  std::for_each(fetch_begin, fetch_end, [cycle = current_cycle, this](auto& sq_entry) {
-    this->do_finish_store(sq_entry);
-    sq_entry.fetch_issued = true;
-    sq_entry.event_cycle = cycle;
-  });
+    do_finish_store(*it);
+    it->fetch_issued = true;
+    it->event_cycle = current_cycle;
+    --store_bw;
+  }
+
+  const auto complete_id = oldest_unretired();
+  long committed = 0;
+  blocked = 0;
+  for (auto it = std::begin(SQ); it != std::end(SQ) && store_bw > 0 && blocked != all_threads; ++it) {
+    if (blocked & (1u << it->thread))
+      continue;
+    if (it->instr_id < complete_id[it->thread] && it->event_cycle <= current_cycle && do_complete_store(*it)) {
+      release_sq(*it);
+      ++committed;
+      --store_bw;
+    } else {
+      blocked |= 1u << it->thread;
+    }
+  }
 
-  auto [complete_begin, complete_end] = champsim::get_span_p(std::cbegin(SQ), std::cend(SQ), store_bw, do_complete);
-  store_bw -= std::distance(complete_begin, complete_end);
-  SQ.erase(complete_begin, complete_end);
+  auto committed_end = std::find_if_not(std::begin(SQ), std::end(SQ), [](const auto& x) { return x.committed; });
+  if (std::distance(std::begin(SQ), committed_end) == committed)
+    SQ.erase(std::begin(SQ), committed_end);
+  else
+    SQ.erase(std::remove_if(std::begin(SQ), std::end(SQ), [](const auto& x) { return x.committed; }), std::end(SQ));
 
   auto load_bw = LQ_WIDTH;
 
@@ -849,22 +886,91 @@ void O3_CPU::operate_lsq()
       if (success) {
         --load_bw;
         lq_entry->fetch_issued = true;
+        lq_by_block[lq_entry->virtual_address >> LOG2_BLOCK_SIZE].push_back(static_cast<uint32_t>(&lq_entry - std::data(LQ)));
       }
     }
   }
 }
 
+std::array<uint64_t, MAX_SMT_THREADS> O3_CPU::oldest_unretired() const
+{
+  std::array<uint64_t, MAX_SMT_THREADS> retval;
+  retval.fill(std::numeric_limits<uint64_t>::max());
+
+  std::size_t found = 0;
+  for (auto it = std::cbegin(ROB); it != std::cend(ROB) && found < std::size(threads); ++it) {
+    if (!it->retired && retval[it->thread] == std::numeric_limits<uint64_t>::max()) {
+      retval[it->thread] = it->instr_id;
+      ++found;
+    }
+  }
+  return retval;
+}
+
+void O3_CPU::do_finish_mem_op(const LSQ_ENTRY& lsq_entry)
+{
+  // The instruction waits for the last of its memory operations before it completes
+  auto& rob_entry = lsq_entry.finish(std::begin(ROB), std::end(ROB));
+  if (rob_entry.executed == INFLIGHT && rob_entry.completed_mem_ops == rob_entry.num_mem_ops())
+    complete_wakeup.push(&rob_entry);
+}
+
 void O3_CPU::do_finish_store(const LSQ_ENTRY& sq_entry)
 {
-  sq_entry.finish(std::begin(ROB), std::end(ROB));
+  do_finish_mem_op(sq_entry);
 
   // Release dependent loads
   for (std::optional<LSQ_ENTRY>& dependent : sq_entry.lq_depend_on_me) {
     assert(dependent.has_value()); // LQ entry is still allocated
     assert(dependent->producer_id == sq_entry.instr_id);
 
-    dependent->finish(std::begin(ROB), std::end(ROB));
-    dependent.reset();
+    do_finish_mem_op(*dependent);
+    release_lq(dependent);
+  }
+}
+
+std::optional<LSQ_ENTRY>& O3_CPU::allocate_lq(uint8_t thread)
+{
+  assert(!std::empty(lq_free));
+  auto& lq_entry = LQ[lq_free.top()];
+  lq_free.pop();
+  ++threads[thread].lq_occupancy;
+  return lq_entry;
+}
+
+void O3_CPU::release_lq(std::optional<LSQ_ENTRY>& lq_entry)
+{
+  --threads[lq_entry->thread].lq_occupancy;
+  lq_entry.reset();
+  lq_free.push(static_cast<uint32_t>(&lq_entry - std::data(LQ)));
+}
+
+void O3_CPU::allocate_sq(uint8_t thread, LSQ_ENTRY&& sq_entry)
+{
+  sq_entry.thread = thread;
+  auto& indexed = sq_by_address[sq_entry.virtual_address];
+  ++indexed.count;
+  indexed.youngest_id = sq_entry.instr_id;
+  ++threads[sq_entry.thread].sq_occupancy;
+  SQ.push_back(std::move(sq_entry));
+}
+
+void O3_CPU::release_sq(LSQ_ENTRY& sq_entry)
+{
+  // The entry is marked, and leaves the SQ at the end of the cycle
+  sq_entry.committed = true;
+  --threads[sq_entry.thread].sq_occupancy;
+
+  auto indexed = sq_by_address.find(sq_entry.virtual_address);
+  assert(indexed != std::end(sq_by_address));
+  if (--indexed->second.count == 0) {
+    sq_by_address.erase(indexed);
+  } else if (indexed->second.youngest_id == sq_entry.instr_id) {
+    // Another thread may store to the same address, and not yet have committed
+    indexed->second.youngest_id = 0;
+    for (const auto& x : SQ)
+      if (!x.committed && x.virtual_address == sq_entry.virtual_address)
+        indexed->second.youngest_id = std::max(indexed->second.youngest_id, x.instr_id);
   }
 }
 
@@ -914,39 +1020,134 @@ bool O3_CPU::execute_load(const LSQ_ENTRY& lq_entry)
   return L1D_bus.issue_read(data_packet);
 }
 
-void O3_CPU::do_complete_execution(ooo_model_instr& instr)
+void O3_CPU::assign_thread(ooo_model_instr& instr, uint8_t thread) const
 {
-  for (auto dreg : instr.destination_registers) {
-    auto begin = std::begin(reg_producers[dreg]);
-    auto end = std::end(reg_producers[dreg]);
-    auto elem = std::find_if(begin, end, [id = instr.instr_id](ooo_model_instr& x) { return x.instr_id == id; });
-    assert(elem != end);
-    reg_producers[dreg].erase(elem);
+  // The first thread keeps the addresses of its trace, so that a core of one thread is unchanged
+  instr.thread = thread;
+  if (thread == 0)
+    return;
+
+  const auto tag = uint64_t{thread} << SMT_ASID_SHIFT;
+  instr.ip ^= tag;
+  if (instr.branch_target != 0)
+    instr.branch_target ^= tag;
+  for (auto& addr : instr.source_memory)
+    addr ^= tag;
+  for (auto& addr : instr.destination_memory)
+    addr ^= tag;
+
+#if defined(MULTIPLE_PAGE_SIZE)
+  auto tag_page = [tag](uint8_t size, uint64_t& base_vpn) {
+    if (size != 0)
+      base_vpn ^= tag >> (size == champsim::LARGE_PAGE ? champsim::LARGE_PAGE_BITS : champsim::SMALL_PAGE_BITS);
+  };
+  tag_page(instr.ip_page_size, instr.ip_base_vpn);
+  for (std::size_t i = 0; i < std::size(instr.page_size_source); ++i)
+    tag_page(instr.page_size_source[i], instr.base_vpn_source[i]);
+  for (std::size_t i = 0; i < std::size(instr.page_size_destination); ++i)
+    tag_page(instr.page_size_destination[i], instr.base_vpn_destination[i]);
+#endif
+}
+
+void O3_CPU::functional_execute(ooo_model_instr arch_instr)
+{
+  do_init_instruction(arch_instr, true);
+
+  // Fetch each run of instructions in a block once, unless the DIB holds them.
+  // A DIB hit already makes its entry the most recent, so only misses fill it.
+  auto fetch_block = arch_instr.ip >> LOG2_BLOCK_SIZE;
+  auto dib_hit = DIB.check_hit(arch_instr.ip).has_value();
+  if (!dib_hit && fetch_block != functional_fetch_block) {
+    functional_request fetch;
+    fetch.v_address = arch_instr.ip;
+    fetch.instr_id = arch_instr.instr_id;
+    fetch.ip = arch_instr.ip;
+
+#if defined ENABLE_EXTRA_CACHE_STATS || defined FORCE_HIT || defined FORCE_PTE_HIT
+    fetch.is_instr = true;
+#endif
+
+#if defined(MULTIPLE_PAGE_SIZE)
+    std::tie(fetch.page_size, fetch.base_vpn) = lookup_page_size(true, arch_instr.ip, arch_instr.ip_page());
+#endif
+
+    L1I_bus.functional_read(fetch);
   }
+  functional_fetch_block = fetch_block;
+  if (!dib_hit)
+    do_dib_update(arch_instr);
+
+  auto data_request = [&arch_instr, this](uint64_t addr, [[maybe_unused]] bool is_source, [[maybe_unused]] std::size_t idx) {
+    functional_request request;
+    request.v_address = addr;
+    request.instr_id = arch_instr.instr_id;
+    request.ip = arch_instr.ip;
+
+#if defined(MULTIPLE_PAGE_SIZE)
+    std::tie(request.page_size, request.base_vpn) = lookup_page_size(false, addr,
+                                                                     is_source ? arch_instr.source_page(idx) : arch_instr.destination_page(idx));
+#endif
+
+    return request;
+  };
+
+  for (std::size_t i = 0; i < std::size(arch_instr.source_memory); ++i)
+    L1D_bus.functional_read(data_request(arch_instr.source_memory[i], true, i));
+  for (std::size_t i = 0; i < std::size(arch_instr.destination_memory); ++i)
+    L1D_bus.functional_write(data_request(arch_instr.destination_memory[i], false, i));
+
+  ++num_retired;
+  ++threads[arch_instr.thread].num_retired;
+
+#if defined PTP_REPLACEMENT_POLICY
+  RETIRED_INSTRS = sim_instr();
+#endif
+
+  // heartbeat
+  if (show_heartbeat && (num_retired >= next_print_instruction)) {
+    auto [elapsed_hour, elapsed_minute, elapsed_second] = elapsed_time();
+
+    std::ostringstream line;
+    line << "Heartbeat CPU " << cpu << " instructions: " << num_retired << " (functional)";
+    line << " (Simulation time: " << elapsed_hour << " hr " << elapsed_minute << " min " << elapsed_second << " sec) " << std::endl;
+    std::cout << line.str() << std::flush;
+    next_print_instruction += STAT_PRINTING_PERIOD;
+
+    last_heartbeat_instr = num_retired;
+  }
+}
+
+void O3_CPU::do_complete_execution(ooo_model_instr& instr)
+{
+  for (auto phys_reg : instr.destination_phys_regs)
+    phys_reg_producer[phys_reg] = nullptr;
 
   instr.executed = COMPLETED;
 
-  for (ooo_model_instr& dependent : instr.registers_instrs_depend_on_me) {
+  for (auto link = std::exchange(instr.first_dependent, NO_DEPENDENT); link != NO_DEPENDENT; link = dependence_pool[link].next) {
+    ooo_model_instr& dependent = *dependence_pool[link].consumer;
     dependent.num_reg_dependent--;
     assert(dependent.num_reg_dependent >= 0);
 
     if (dependent.num_reg_dependent == 0)
-      dependent.scheduled = COMPLETED;
+      execute_wakeup.push(&dependent);
+    dependence_free.push_back(link);
   }
 
-  if (instr.branch_mispredicted)
-    fetch_resume_cycle = current_cycle + BRANCH_MISPREDICT_PENALTY;
+  if (instr.branch_mispredicted) {
+    threads[instr.thread].fetch_resume_cycle = current_cycle + BRANCH_MISPREDICT_PENALTY;
+    resolve_branch(instr.thread);
+  }
 }
 
 void O3_CPU::complete_inflight_instruction()
 {
-  // update ROB entries with completed executions
-  auto complete_bw = EXEC_WIDTH;
-  for (auto rob_it = std::begin(ROB); rob_it != std::end(ROB) && complete_bw > 0; ++rob_it) {
-    if ((rob_it->executed == INFLIGHT) && (rob_it->event_cycle <= current_cycle) && rob_it->completed_mem_ops == rob_it->num_mem_ops()) {
-      do_complete_execution(*rob_it);
-      --complete_bw;
-    }
+  // update ROB entries with completed executions, oldest first
+  wake_up(complete_wakeup, complete_ready);
+  for (auto complete_bw = EXEC_WIDTH; complete_bw > 0 && !std::empty(complete_ready); --complete_bw) {
+    auto next = complete_ready.top();
+    complete_ready.pop();
+    do_complete_execution(*next);
   }
 }
 
@@ -976,11 +1177,15 @@ void O3_CPU::handle_memory_return()
 
   auto l1d_it = std::begin(L1D_bus.PROCESSED);
   for (auto l1d_bw = L1D_BANDWIDTH; l1d_bw > 0 && l1d_it != std::end(L1D_bus.PROCESSED); --l1d_bw, ++l1d_it) {
-    for (auto& lq_entry : LQ) {
-      if (lq_entry.has_value() && lq_entry->fetch_issued && lq_entry->virtual_address >> LOG2_BLOCK_SIZE == l1d_it->v_address >> LOG2_BLOCK_SIZE) {
-        lq_entry->finish(std::begin(ROB), std::end(ROB));
-        lq_entry.reset();
+    auto waiting = lq_by_block.find(l1d_it->v_address >> LOG2_BLOCK_SIZE);
+    if (waiting != std::end(lq_by_block)) {
+      // Finish the loads in the order of their LQ slots
+      std::sort(std::begin(waiting->second), std::end(waiting->second));
+      for (auto idx : waiting->second) {
+        do_finish_mem_op(*LQ[idx]);
+        release_lq(LQ[idx]);
       }
+      lq_by_block.erase(waiting);
     }
   }
   L1D_bus.PROCESSED.erase(std::begin(L1D_bus.PROCESSED), l1d_it);
@@ -988,18 +1193,140 @@ void O3_CPU::handle_memory_return()
 
 void O3_CPU::retire_rob()
 {
-  auto [retire_begin, retire_end] = champsim::get_span_p(std::cbegin(ROB), std::cend(ROB), RETIRE_WIDTH, [](const auto& x) { return x.executed == COMPLETED; });
-  if constexpr (champsim::debug_print) {
-    std::for_each(retire_begin, retire_end, [](const auto& x) { std::cout << "[ROB] retire_rob instr_id: " << x.instr_id << " is retired" << std::endl; });
+  // Each thread retires in its own program order. An entry leaves the ROB once every older entry has retired.
+  const auto all_threads = (1u << std::size(threads)) - 1;
+  unsigned blocked = 0;
+  auto retire_bw = RETIRE_WIDTH;
+  for (auto it = std::begin(ROB); it != std::end(ROB) && retire_bw > 0 && blocked != all_threads; ++it) {
+    if (it->retired || (blocked & (1u << it->thread)))
+      continue;
+    if (it->executed != COMPLETED) {
+      blocked |= 1u << it->thread;
+      continue;
+    }
+
+    if constexpr (champsim::debug_print) {
+      std::cout << "[ROB] retire_rob instr_id: " << it->instr_id << " is retired" << std::endl;
+    }
+    it->retired = true;
+    for (auto phys_reg : it->replaced_phys_regs)
+      if (phys_reg != NO_PHYS_REG)
+        phys_reg_free.push_back(phys_reg);
+    --threads[it->thread].rob_occupancy;
+    ++threads[it->thread].num_retired;
+    ++num_retired;
+    --retire_bw;
   }
-  num_retired += std::distance(retire_begin, retire_end);
-  ROB.erase(retire_begin, retire_end);
+  auto retired_end = std::find_if_not(std::begin(ROB), std::end(ROB), [](const auto& x) { return x.retired; });
+  num_scheduled -= static_cast<std::size_t>(std::distance(std::begin(ROB), retired_end));
+  ROB.erase(std::begin(ROB), retired_end);
 
   // Check for deadlock
   if (!std::empty(ROB) && (ROB.front().event_cycle + DEADLOCK_CYCLE) <= current_cycle)
     throw champsim::deadlock{cpu};
 }
 
+uint64_t O3_CPU::next_event_cycle() const
+{
+  // Each stage contributes the first cycle at which its readiness check in operate() could pass.
+  // Anything that acts regardless of the cycle makes the core busy now.
+  constexpr auto never = std::numeric_limits<uint64_t>::max();
+  uint64_t next = never;
+  auto at = [&next](uint64_t cycle) { next = std::min(next, cycle); };
+  auto deadlock_at = [at](uint64_t cycle) { at(champsim::saturating_add(cycle, DEADLOCK_CYCLE)); };
+
+  // Memory returns are always consumed immediately
+  if (!std::empty(L1I_bus.PROCESSED) || !std::empty(L1D_bus.PROCESSED))
+    return current_cycle;
+
+  // retire, complete, execute
+  if (!std::empty(ROB))
+    deadlock_at(ROB.front().event_cycle);
+
+  const auto complete_id = oldest_unretired();
+  for (const auto& thread_oldest : complete_id) {
+    if (thread_oldest != std::numeric_limits<uint64_t>::max()) {
+      auto rob_entry = std::partition_point(std::cbegin(ROB), std::cend(ROB), [id = thread_oldest](const auto& x) { return x.instr_id < id; });
+      if (rob_entry->executed == COMPLETED)
+        return current_cycle;
+    }
+  }
+
+  if (!std::empty(execute_ready) || !std::empty(complete_ready))
+    return current_cycle;
+  if (!std::empty(execute_wakeup))
+    at(execute_wakeup.top()->event_cycle);
+  if (!std::empty(complete_wakeup))
+    at(complete_wakeup.top()->event_cycle);
+
+  // schedule
+  if (num_scheduled < std::size(ROB) && scheduler_occupancy < static_cast<std::size_t>(SCHEDULER_SIZE) && can_rename(ROB[num_scheduled]))
+    return current_cycle;
+
+  // store queue, in order within each thread
+  unsigned seen = 0, seen_unfetched = 0;
+  for (const auto& sq_entry : SQ) {
+    auto bit = 1u << sq_entry.thread;
+    if (!(seen & bit) && sq_entry.instr_id < complete_id[sq_entry.thread])
+      at(sq_entry.event_cycle);
+    if (!(seen_unfetched & bit) && !sq_entry.fetch_issued) {
+      at(sq_entry.event_cycle);
+      seen_unfetched |= bit;
+    }
+    seen |= bit;
+  }
+
+  // load queue
+  for (const auto& lq_entry : LQ) {
+    if (lq_entry.has_value() && lq_entry->producer_id == std::numeric_limits<uint64_t>::max() && !lq_entry->fetch_issued)
+      at(champsim::saturating_add<uint64_t>(lq_entry->event_cycle, 1));
+  }
+
+  // dispatch
+  if (!std::empty(DISPATCH_BUFFER)) {
+    const auto& front = DISPATCH_BUFFER.front();
+    if (can_dispatch(front))
+      at(champsim::saturating_add<uint64_t>(front.event_cycle, 1));
+    deadlock_at(front.event_cycle);
+  }
+
+  // decode
+  if (!std::empty(DECODE_BUFFER)) {
+    if (std::size(DISPATCH_BUFFER) < DISPATCH_BUFFER_SIZE)
+      at(DECODE_BUFFER.front().event_cycle);
+    deadlock_at(DECODE_BUFFER.front().event_cycle);
+  }
+
+  // promote to decode, fetch, DIB
+  if (!std::empty(IFETCH_BUFFER)) {
+    if (IFETCH_BUFFER.front().fetched == COMPLETED && std::size(DECODE_BUFFER) < DECODE_BUFFER_SIZE)
+      at(IFETCH_BUFFER.front().event_cycle);
+    deadlock_at(IFETCH_BUFFER.front().event_cycle);
+
+    auto needs_action = [](const ooo_model_instr& x) { return !x.dib_checked || (x.dib_checked == COMPLETED && !x.fetched); };
+    if (std::any_of(std::cbegin(IFETCH_BUFFER), std::cend(IFETCH_BUFFER), needs_action))
+      return current_cycle;
+  }
+
+  // initialize
+  for (const auto& thread : threads)
+    if (fetchable(thread) > 0 && std::size(IFETCH_BUFFER) < IFETCH_BUFFER_SIZE)
+      at(thread.fetch_resume_cycle);
+
+#if defined(ENABLE_FDIP)
+  if (fdip.isEnabled()) {
+    if (!fdip.empty())
+      return current_cycle;
+    if (fdip.isDecoupled() && std::any_of(std::cbegin(threads), std::cend(threads), [this](const auto& x) { return can_predict_ahead(x); }))
+      return current_cycle;
+    if (!fdip.isDecoupled() && !std::empty(IFETCH_BUFFER) && IFETCH_BUFFER[std::min(fdip.getRunAhead(), std::size(IFETCH_BUFFER)) - 1].instr_id > fdip.getLastAddedInstr())
+      return current_cycle;
+  }
+#endif
+
+  return std::max(next, current_cycle);
+}
+
 void CacheBus::return_data(const PACKET& packet) { PROCESSED.push_back(packet); }
 
 void O3_CPU::print_deadlock()
@@ -1059,6 +1386,27 @@ void O3_CPU::print_deadlock()
   }
 }
 
+// The pipeline is not saved. A restored core resumes its trace at the oldest instruction that had not retired.
+void O3_CPU::serialize(champsim::checkpoint_archive& ar)
+{
+  ar.io(num_retired);
+  if (std::size(threads) > 1) {
+    ar.expect(std::size(threads));
+    for (auto& thread : threads)
+      ar.io(thread.num_retired);
+  } else {
+    threads.front().num_retired = num_retired;
+  }
+  ar.io(last_heartbeat_instr);
+  ar.io(last_heartbeat_cycle);
+  ar.io(next_print_instruction);
+  ar.io(DIB);
+#if defined(MULTIPLE_PAGE_SIZE)
+  ar.io(code_page_sizes);
+  ar.io(data_page_sizes);
+#endif
+}
+
 #if defined(MULTIPLE_PAGE_SIZE)
 LSQ_ENTRY::LSQ_ENTRY( uint64_t id, uint64_t addr, uint64_t local_ip, std::array<uint8_t, 2> local_asid, 
 										 	uint32_t pgsz, uint64_t vpn) 
@@ -1072,9 +1420,9 @@ LSQ_ENTRY::LSQ_ENTRY(uint64_t id, uint64_t addr, uint64_t local_ip, std::array<u
 }
 #endif 
 
-void LSQ_ENTRY::finish(std::deque<ooo_model_instr>::iterator begin, std::deque<ooo_model_instr>::iterator end) const
+ooo_model_instr& LSQ_ENTRY::finish(champsim::instr_queue::iterator begin, champsim::instr_queue::iterator end) const
 {
-  auto rob_entry = std::partition_point(begin, end, [id = this->instr_id](auto x) { return x.instr_id < id; });
+  auto rob_entry = std::partition_point(begin, end, [id = this->instr_id](const auto& x) { return x.instr_id < id; });
   assert(rob_entry != end);
   assert(rob_entry->instr_id == this->instr_id);
 
@@ -1086,6 +1434,8 @@ void LSQ_ENTRY::finish(std::deque<ooo_model_instr>::iterator begin, std::deque<o
     std::cout << " full_address: " << virtual_address << std::dec << " remain_mem_ops: " << rob_entry->num_mem_ops() - rob_entry->completed_mem_ops;
     std::cout << " event_cycle: " << event_cycle << std::endl;
   }
+
+  return *rob_entry;
 }
 
 bool CacheBus::issue_read(PACKET data_packet)
@@ -1106,3 +1456,21 @@ bool CacheBus::issue_write(PACKET data_packet)
 
   return lower_level->add_wq(data_packet);
 }
+
+void CacheBus::functional_read(functional_request request)
+{
+  request.address = request.v_address;
+  request.cpu = cpu;
+  request.type = LOAD;
+
+  lower_level->functional_access(request);
+}
+
+void CacheBus::functional_write(functional_request request)
+{
+  request.address = request.v_address;
+  request.cpu = cpu;
+  request.type = WRITE;
+
+  lower_level->functional_access(request);
+}
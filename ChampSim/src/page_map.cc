@@ -0,0 +1,92 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "page_map.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "trace_format.h"
+
+namespace
+{
+constexpr std::size_t HEADER_SIZE = sizeof(uint64_t); // the magic and version, after which the words are aligned
+
+void write_word(std::ostream& out, uint64_t word) { out.write(reinterpret_cast<const char*>(&word), sizeof(word)); }
+} // namespace
+
+void champsim::write_page_size_map(std::ostream& out, const std::vector<uint64_t>& code_regions, const std::vector<uint64_t>& data_regions)
+{
+  std::array<char, HEADER_SIZE> header = {};
+  std::copy(std::begin(PAGE_MAP_MAGIC), std::end(PAGE_MAP_MAGIC), std::begin(header));
+  header[std::size(PAGE_MAP_MAGIC)] = static_cast<char>(PAGE_MAP_VERSION);
+  out.write(std::data(header), std::size(header));
+
+  write_word(out, std::size(code_regions));
+  write_word(out, std::size(data_regions));
+  for (auto region : code_regions)
+    write_word(out, region);
+  for (auto region : data_regions)
+    write_word(out, region);
+}
+
+champsim::page_size_map::page_size_map(const std::string& fname)
+{
+  auto fd = open(fname.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("Could not open page size map " + fname);
+
+  struct stat status;
+  if (fstat(fd, &status) == 0 && static_cast<std::size_t>(status.st_size) >= HEADER_SIZE + 2 * sizeof(uint64_t)) {
+    mapping_size = static_cast<std::size_t>(status.st_size);
+    mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+  if (mapping == nullptr || mapping == MAP_FAILED) {
+    mapping = nullptr;
+    throw std::runtime_error("Could not map page size map " + fname);
+  }
+
+  auto bytes = static_cast<const char*>(mapping);
+  auto words = reinterpret_cast<const uint64_t*>(bytes + HEADER_SIZE);
+  auto num_words = (mapping_size - HEADER_SIZE) / sizeof(uint64_t);
+  if (!std::equal(std::begin(PAGE_MAP_MAGIC), std::end(PAGE_MAP_MAGIC), bytes) || static_cast<uint8_t>(bytes[std::size(PAGE_MAP_MAGIC)]) != PAGE_MAP_VERSION
+      || words[0] > num_words - 2 || words[1] > num_words - 2 - words[0]) {
+    munmap(mapping, mapping_size);
+    mapping = nullptr;
+    throw std::runtime_error(fname + " is not a page size map of version " + std::to_string(PAGE_MAP_VERSION));
+  }
+
+  code_begin = words + 2;
+  code_end = code_begin + words[0];
+  data_begin = code_end;
+  data_end = data_begin + words[1];
+}
+
+champsim::page_size_map::~page_size_map()
+{
+  if (mapping != nullptr)
+    munmap(mapping, mapping_size);
+}
+
+bool champsim::page_size_map::is_large_code(uint64_t addr) const { return std::binary_search(code_begin, code_end, addr >> LARGE_PAGE_BITS); }
+
+bool champsim::page_size_map::is_large_data(uint64_t addr) const { return std::binary_search(data_begin, data_end, addr >> LARGE_PAGE_BITS); }
@@ -0,0 +1,314 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "page_size_oracle.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+constexpr std::size_t HEADER_SIZE = sizeof(uint64_t); // the magic and version, after which the words are aligned
+
+void write_word(std::ostream& out, uint64_t word) { out.write(reinterpret_cast<const char*>(&word), sizeof(word)); }
+
+// splitmix64, which advances the state and returns its next output
+uint64_t splitmix(uint64_t& state)
+{
+  auto z = (state += 0x9e3779b97f4a7c15ull);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+} // namespace
+
+void champsim::page_size_table::unmap()
+{
+  if (mapping != nullptr)
+    munmap(mapping, mapping_size);
+  mapping = nullptr;
+  mapping_size = 0;
+  pages = nullptr;
+  sizes = nullptr;
+  num_mapped = 0;
+}
+
+std::size_t champsim::page_size_table::slot_index(uint64_t page) const
+{
+  // Fibonacci hashing into a power-of-two table
+  auto mask = std::size(added) - 1;
+  auto index = static_cast<std::size_t>((page * 0x9e3779b97f4a7c15ull) >> 32) & mask;
+  while (added[index].size != 0 && added[index].page != page)
+    index = (index + 1) & mask;
+  return index;
+}
+
+void champsim::page_size_table::add(uint64_t page, uint8_t size)
+{
+  // Kept at most half full
+  if (2 * (num_added + 1) > std::size(added)) {
+    std::vector<slot> old(std::max<std::size_t>(1024, 2 * std::size(added)));
+    std::swap(old, added);
+    for (const auto& entry : old)
+      if (entry.size != 0)
+        added[slot_index(entry.page)] = entry;
+  }
+
+  auto& entry = added[slot_index(page)];
+  if (entry.size == 0)
+    ++num_added;
+  entry = {page, size};
+}
+
+bool champsim::page_size_table::load(const std::string& fname)
+{
+  unmap();
+  added.clear();
+  num_added = 0;
+  modified = false;
+
+  auto fd = open(fname.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat status;
+  std::array<char, HEADER_SIZE> header = {};
+  auto is_table = fstat(fd, &status) == 0 && pread(fd, std::data(header), std::size(header), 0) == static_cast<ssize_t>(std::size(header))
+                  && std::equal(std::begin(PAGE_TABLE_MAGIC), std::end(PAGE_TABLE_MAGIC), std::begin(header));
+  if (!is_table) {
+    close(fd);
+    load_text(fname);
+    return true;
+  }
+
+  mapping_size = static_cast<std::size_t>(status.st_size);
+  mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    mapping = nullptr;
+    throw std::runtime_error("Could not map page size table " + fname);
+  }
+
+  auto bytes = static_cast<const char*>(mapping);
+  auto count = mapping_size >= HEADER_SIZE + sizeof(uint64_t) ? *reinterpret_cast<const uint64_t*>(bytes + HEADER_SIZE) : 0;
+  if (static_cast<uint8_t>(header[std::size(PAGE_TABLE_MAGIC)]) != PAGE_TABLE_VERSION || mapping_size < HEADER_SIZE + sizeof(uint64_t)
+      || count > (mapping_size - HEADER_SIZE - sizeof(uint64_t)) / (sizeof(uint64_t) + sizeof(uint8_t))) {
+    unmap();
+    throw std::runtime_error(fname + " is not a page size table of version " + std::to_string(PAGE_TABLE_VERSION));
+  }
+
+  num_mapped = static_cast<std::size_t>(count);
+  pages = reinterpret_cast<const uint64_t*>(bytes + HEADER_SIZE + sizeof(uint64_t));
+  sizes = reinterpret_cast<const uint8_t*>(pages + num_mapped);
+  return true;
+}
+
+void champsim::page_size_table::load_text(const std::string& fname)
+{
+  std::ifstream file{fname};
+  std::string text{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  auto pos = text.c_str();
+  auto end = pos + std::size(text);
+  while (pos < end) {
+    char* next = nullptr;
+    auto page = std::strtoull(pos, &next, 10);
+    if (next == pos || *next != ':')
+      break;
+    pos = next + 1;
+    auto size = std::strtoul(pos, &next, 10);
+    if (next == pos)
+      break;
+    add(page, static_cast<uint8_t>(size));
+    pos = next;
+    while (pos < end && *pos == '\n')
+      ++pos;
+  }
+
+  // Saved again in the binary format
+  modified = true;
+}
+
+std::optional<uint8_t> champsim::page_size_table::find_mapped(uint64_t page) const
+{
+  auto it = std::lower_bound(pages, pages + num_mapped, page);
+  if (it == pages + num_mapped || *it != page)
+    return std::nullopt;
+  return sizes[it - pages];
+}
+
+std::optional<uint8_t> champsim::page_size_table::find(uint64_t page) const
+{
+  if (num_added > 0) {
+    if (const auto& entry = added[slot_index(page)]; entry.size != 0)
+      return entry.size;
+  }
+  return find_mapped(page);
+}
+
+void champsim::page_size_table::assign(uint64_t page, uint8_t size)
+{
+  if (find(page) != size) {
+    add(page, size);
+    modified = true;
+  }
+}
+
+void champsim::page_size_table::insert(uint64_t page, uint8_t size)
+{
+  if (!find(page).has_value()) {
+    add(page, size);
+    modified = true;
+  }
+}
+
+std::vector<std::pair<uint64_t, uint8_t>> champsim::page_size_table::entries() const
+{
+  std::vector<std::pair<uint64_t, uint8_t>> newer;
+  for (const auto& entry : added)
+    if (entry.size != 0)
+      newer.emplace_back(entry.page, entry.size);
+  std::sort(std::begin(newer), std::end(newer));
+
+  // The pages added in this run take the place of the same pages in the file
+  std::vector<std::pair<uint64_t, uint8_t>> retval;
+  retval.reserve(num_mapped + std::size(newer));
+  auto newer_it = std::begin(newer);
+  for (std::size_t i = 0; i < num_mapped; ++i) {
+    for (; newer_it != std::end(newer) && newer_it->first < pages[i]; ++newer_it)
+      retval.push_back(*newer_it);
+    if (newer_it == std::end(newer) || newer_it->first != pages[i])
+      retval.emplace_back(pages[i], sizes[i]);
+  }
+  retval.insert(std::end(retval), newer_it, std::end(newer));
+  return retval;
+}
+
+void champsim::page_size_table::save(const std::string& fname)
+{
+  if (!modified)
+    return;
+
+  auto table = entries();
+  std::array<char, HEADER_SIZE> header = {};
+  std::copy(std::begin(PAGE_TABLE_MAGIC), std::end(PAGE_TABLE_MAGIC), std::begin(header));
+  header[std::size(PAGE_TABLE_MAGIC)] = static_cast<char>(PAGE_TABLE_VERSION);
+
+  // Written aside and renamed over the file, which may still be mapped
+  auto temp_name = fname + ".tmp" + std::to_string(getpid());
+  {
+    std::ofstream out{temp_name, std::ios::binary};
+    out.write(std::data(header), std::size(header));
+    write_word(out, std::size(table));
+    for (const auto& entry : table)
+      write_word(out, entry.first);
+    for (const auto& entry : table)
+      out.put(static_cast<char>(entry.second));
+    if (!out.flush())
+      throw std::runtime_error("Could not write " + temp_name);
+  }
+  if (std::rename(temp_name.c_str(), fname.c_str()) != 0)
+    throw std::runtime_error("Could not replace " + fname);
+  modified = false;
+}
+
+void champsim::page_size_table::serialize(checkpoint_archive& ar)
+{
+  std::vector<std::pair<uint64_t, uint8_t>> table;
+  if (!ar.is_loading())
+    table = entries();
+
+  uint64_t count = std::size(table);
+  ar.io(count);
+  table.resize(static_cast<std::size_t>(count));
+  for (auto& [page, size] : table) {
+    ar.io(page);
+    ar.io(size);
+  }
+
+  if (ar.is_loading()) {
+    unmap();
+    added.clear();
+    num_added = 0;
+    for (auto [page, size] : table)
+      add(page, size);
+    modified = true;
+  }
+}
+
+void champsim::page_size_oracle::seed(uint64_t seed, uint64_t stream)
+{
+  // Far apart in the sequence for each stream of the same seed
+  rng_state = seed ^ (stream * 0xd1b54a32d192ed03ull);
+}
+
+void champsim::page_size_oracle::use_map(std::shared_ptr<const page_size_map> page_map, bool instr)
+{
+  map = std::move(page_map);
+  is_instr = instr;
+}
+
+champsim::page_size_oracle::page_type champsim::page_size_oracle::find_or_choose(uint64_t addr, page_type traced_page)
+{
+  const auto small_page = addr >> SMALL_PAGE_BITS;
+  const auto large_page = addr >> LARGE_PAGE_BITS;
+
+  // Any change to the table may change the page of any address
+  last_page = std::numeric_limits<uint64_t>::max();
+  if (traced_page.first != 0) {
+    table.assign(traced_page.second, traced_page.first);
+    return traced_page;
+  }
+
+  // The pages are still recorded, for the counts of large and small pages touched
+  if (map) {
+    page_type page{SMALL_PAGE, small_page};
+    if (is_instr ? map->is_large_code(addr) : map->is_large_data(addr))
+      page = {LARGE_PAGE, large_page};
+    table.insert(page.second, page.first);
+    last_page = small_page;
+    last_result = page;
+    return page;
+  }
+
+  // A 4 KB page that holds the address takes precedence over a 2 MB page
+  std::optional<uint8_t> size = table.find(small_page);
+  if (!size.has_value())
+    size = table.find(large_page);
+
+  // if not found we have a new entry, decide page size with the given probability.
+  if (!size.has_value()) {
+    size = (splitmix(rng_state) % 100 < large_page_dist) ? LARGE_PAGE : SMALL_PAGE;
+    table.insert(*size == LARGE_PAGE ? large_page : small_page, *size);
+  }
+
+  last_page = small_page;
+  last_result = {*size, (*size == LARGE_PAGE) ? large_page : small_page};
+  return last_result;
+}
+
+void champsim::page_size_oracle::serialize(checkpoint_archive& ar)
+{
+  table.serialize(ar);
+  last_page = std::numeric_limits<uint64_t>::max();
+}
@@ -0,0 +1,424 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parallel_sim.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <thread>
+
+#include "cache.h"
+#include "champsim.h"
+#include "ooo_cpu.h"
+#include "ptw.h"
+#include "util.h"
+#include "vmem.h"
+
+std::tuple<uint64_t, uint64_t, uint64_t> elapsed_time();
+
+namespace
+{
+template <typename Pred>
+void spin_until(Pred&& pred)
+{
+  while (!pred())
+    std::this_thread::yield();
+}
+} // namespace
+
+namespace champsim
+{
+
+quantum_channel::quantum_channel(MemoryRequestProducer& producer) : MemoryRequestProducer(producer.lower_level), upper(producer)
+{
+  for (uint8_t type = 1; type < NUM_QUEUE_TYPES; ++type) {
+    capacity[type] = lower_level->get_size(type, 0);
+    occupancy[type] = lower_level->get_occupancy(type, 0);
+    for (auto& slot : published_occupancy)
+      slot[type] = occupancy[type];
+  }
+
+  upper.lower_level = this;
+}
+
+quantum_channel::~quantum_channel() { upper.lower_level = lower_level; }
+
+bool quantum_channel::add(uint8_t queue_type, const PACKET& packet)
+{
+  if (occupancy[queue_type] + issued_prev[queue_type] + issued_cur[queue_type] >= capacity[queue_type])
+    return false;
+
+  // Dependent instructions belong to the core and never cross threads
+  request req{worker_quantum, queue_type, packet};
+  req.packet.instr_depend_on_me.clear();
+  if (!std::empty(packet.to_return)) {
+    pending_returns.push_back({packet.address, packet.to_return});
+    req.packet.to_return = {this};
+  }
+
+  std::lock_guard lock{request_mutex};
+  requests.push_back(std::move(req));
+  ++issued_cur[queue_type];
+  return true;
+}
+
+std::size_t quantum_channel::get_occupancy(uint8_t queue_type, uint64_t)
+{
+  if (queue_type >= NUM_QUEUE_TYPES)
+    return 0;
+  return occupancy[queue_type] + issued_prev[queue_type] + issued_cur[queue_type];
+}
+
+std::size_t quantum_channel::get_size(uint8_t queue_type, uint64_t) { return queue_type < NUM_QUEUE_TYPES ? capacity[queue_type] : 0; }
+
+void quantum_channel::begin_worker_quantum(uint64_t quantum)
+{
+  // The shared side has counted everything issued before the previous quantum
+  worker_quantum = quantum;
+  issued_prev = issued_cur;
+  issued_cur = {};
+  for (uint8_t type = 1; type < NUM_QUEUE_TYPES; ++type)
+    occupancy[type] = published_occupancy[(quantum + 1) % 2][type].load(std::memory_order_acquire);
+
+  std::deque<response> arrived;
+  {
+    std::lock_guard lock{response_mutex};
+    auto end = std::find_if(std::begin(responses), std::end(responses), [quantum](const auto& x) { return x.quantum >= quantum; });
+    std::move(std::begin(responses), end, std::back_inserter(arrived));
+    responses.erase(std::begin(responses), end);
+  }
+
+  for (const auto& [ignored, packet] : arrived) {
+    // Every request for this block was merged below, so each producer is answered exactly once
+    std::vector<MemoryRequestProducer*> to_return;
+    auto matches = [addr = packet.address](const pending_return& x) { return (x.address >> LOG2_BLOCK_SIZE) == (addr >> LOG2_BLOCK_SIZE); };
+    for (auto it = std::find_if(std::begin(pending_returns), std::end(pending_returns), matches); it != std::end(pending_returns);
+         it = std::find_if(it, std::end(pending_returns), matches)) {
+      for (auto ret : it->to_return)
+        if (std::find(std::begin(to_return), std::end(to_return), ret) == std::end(to_return))
+          to_return.push_back(ret);
+      it = pending_returns.erase(it);
+    }
+
+    for (auto ret : to_return)
+      ret->return_data(packet);
+  }
+}
+
+void quantum_channel::return_data(const PACKET& packet)
+{
+  response resp{shared_quantum, packet};
+  resp.packet.instr_depend_on_me.clear();
+  resp.packet.to_return.clear();
+
+  std::lock_guard lock{response_mutex};
+  responses.push_back(std::move(resp));
+}
+
+void quantum_channel::begin_shared_quantum(uint64_t quantum)
+{
+  shared_quantum = quantum;
+
+  std::lock_guard lock{request_mutex};
+  auto end = std::find_if(std::begin(requests), std::end(requests), [quantum](const auto& x) { return x.quantum >= quantum; });
+  std::move(std::begin(requests), end, std::back_inserter(backlog));
+  requests.erase(std::begin(requests), end);
+}
+
+void quantum_channel::end_shared_quantum(uint64_t quantum)
+{
+  for (uint8_t type = 1; type < NUM_QUEUE_TYPES; ++type) {
+    auto waiting = std::count_if(std::begin(backlog), std::end(backlog), [type](const auto& x) { return x.queue_type == type; });
+    published_occupancy[quantum % 2][type].store(lower_level->get_occupancy(type, 0) + static_cast<std::size_t>(waiting), std::memory_order_release);
+  }
+}
+
+void quantum_channel::issue()
+{
+  // Requests are handed down in the order the core issued them
+  while (!std::empty(backlog)) {
+    const auto& [ignored, type, packet] = backlog.front();
+    bool success = false;
+    if (type == 1)
+      success = lower_level->add_rq(packet);
+    else if (type == 2)
+      success = lower_level->add_wq(packet);
+    else if (type == 3)
+      success = lower_level->add_pq(packet);
+    else if (type == 4)
+      success = lower_level->add_ptwq(packet);
+
+    if (!success)
+      return;
+    backlog.pop_front();
+  }
+}
+
+parallel_engine::parallel_engine(std::vector<std::reference_wrapper<O3_CPU>>& cpus, std::vector<std::reference_wrapper<operable>>& operables,
+                                 parallel_config cfg)
+    : config(cfg), shared_phase_applied(std::size(cpus), false)
+{
+  // Find every component that each core can reach through its memory hierarchy
+  std::map<operable*, std::vector<uint32_t>> reached_by;
+  for (O3_CPU& cpu : cpus) {
+    std::vector<operable*> frontier{&cpu};
+    while (!std::empty(frontier)) {
+      auto node = frontier.back();
+      frontier.pop_back();
+
+      auto& reached = reached_by[node];
+      if (std::find(std::begin(reached), std::end(reached), cpu.cpu) != std::end(reached))
+        continue;
+      reached.push_back(cpu.cpu);
+
+      std::vector<MemoryRequestConsumer*> next;
+      if (auto core = dynamic_cast<O3_CPU*>(node); core != nullptr) {
+        next.push_back(core->L1I_bus.lower_level);
+        next.push_back(core->L1D_bus.lower_level);
+      }
+      if (auto cache = dynamic_cast<CACHE*>(node); cache != nullptr)
+        frontier.push_back(&cache->queues);
+      if (auto producer = dynamic_cast<MemoryRequestProducer*>(node); producer != nullptr)
+        next.push_back(producer->lower_level);
+
+      for (auto consumer : next)
+        if (auto op = dynamic_cast<operable*>(consumer); op != nullptr)
+          frontier.push_back(op);
+    }
+  }
+
+  auto owner = [&](operable* op) {
+    auto found = reached_by.find(op);
+    return (found != std::end(reached_by) && std::size(found->second) == 1) ? std::optional<uint32_t>{found->second.front()} : std::nullopt;
+  };
+
+  for (O3_CPU& cpu : cpus) {
+    groups.push_back(std::make_unique<core_group>(cpu));
+    groups.back()->phase_applied.resize(std::size(cpus), false);
+  }
+
+  for (operable& op : operables) {
+    if (auto cpu = owner(&op); cpu.has_value())
+      groups.at(*cpu)->operables.push_back(op);
+    else
+      shared_operables.push_back(op);
+  }
+
+  if (!valid())
+    return;
+
+  for (auto& group : groups)
+    group->schedule.emplace(group->operables);
+  shared_schedule.emplace(shared_operables);
+
+  // Route every request that leaves a core's private hierarchy through a channel
+  for (auto& group : groups) {
+    std::vector<MemoryRequestProducer*> producers{&group->cpu.L1I_bus, &group->cpu.L1D_bus};
+    for (operable& op : group->operables)
+      if (auto producer = dynamic_cast<MemoryRequestProducer*>(&op); producer != nullptr)
+        producers.push_back(producer);
+
+    for (auto producer : producers) {
+      if (!owner(dynamic_cast<operable*>(producer->lower_level)).has_value()) {
+        channels.push_back(std::make_unique<quantum_channel>(*producer));
+        group->channels.push_back(channels.back().get());
+      }
+    }
+  }
+
+  // Physical pages are handed out per core, so that a core's mappings do not depend on the interleaving of the threads
+  for (operable& op : operables) {
+    if (auto ptw = dynamic_cast<PageTableWalker*>(&op); ptw != nullptr) {
+      ptw->vmem.split_by_cpu(std::size(cpus));
+      break;
+    }
+  }
+}
+
+bool parallel_engine::valid() const
+{
+  // Every core must own itself, and nothing it owns may be reachable from another core
+  return std::size(groups) > 1 && std::all_of(std::begin(groups), std::end(groups), [](const auto& g) {
+           return std::any_of(std::begin(g->operables), std::end(g->operables), [&g](const operable& op) { return &op == &g->cpu; });
+         });
+}
+
+template <typename F>
+void parallel_engine::apply_finished(std::vector<bool>& applied, uint64_t before_quantum, F&& end_phase)
+{
+  // Apply the ends of phase in the same order regardless of when they were observed
+  std::vector<std::pair<uint64_t, uint32_t>> finished;
+  for (auto& group : groups) {
+    auto when = group->finish_quantum.load(std::memory_order_acquire);
+    if (!applied.at(group->cpu.cpu) && when < before_quantum)
+      finished.emplace_back(when, group->cpu.cpu);
+  }
+
+  std::sort(std::begin(finished), std::end(finished));
+  for (auto [ignored, cpu] : finished) {
+    applied.at(cpu) = true;
+    end_phase(cpu);
+  }
+}
+
+void parallel_engine::run_core(core_group& group, uint64_t length, const std::string& phase_name, const std::function<void(O3_CPU&)>& refill)
+{
+  auto end_phase = [&group](uint32_t cpu) {
+    for (operable& op : group.operables)
+      op.end_phase(cpu);
+  };
+
+  for (auto quantum = first_quantum;; ++quantum) {
+    spin_until([&] { return shared_next_quantum.load(std::memory_order_acquire) + config.slack >= quantum; });
+    if (quantum >= stop_quantum.load(std::memory_order_acquire))
+      break;
+
+    for (auto channel : group.channels)
+      channel->begin_worker_quantum(quantum);
+
+    // Other cores are known to have finished once the shared side has seen them
+    if (quantum > 0)
+      apply_finished(group.phase_applied, quantum - 1, end_phase);
+
+    for (uint64_t i = 0; i < config.quantum; ++i) {
+      for (auto idx : group.schedule->next()) {
+        try {
+          group.schedule->at(idx)._operate();
+        } catch (champsim::deadlock& dl) {
+          for (operable& c : group.operables) {
+            c.print_deadlock();
+            std::cout << std::endl;
+          }
+
+          abort();
+        }
+      }
+      group.schedule->advance();
+
+      refill(group.cpu);
+
+      if (!group.phase_applied.at(group.cpu.cpu) && group.cpu.sim_instr() >= length) {
+        group.phase_applied.at(group.cpu.cpu) = true;
+        end_phase(group.cpu.cpu);
+        group.finish_quantum.store(quantum, std::memory_order_release);
+
+        auto [elapsed_hour, elapsed_minute, elapsed_second] = elapsed_time();
+        std::ostringstream line;
+        line << phase_name << " finished CPU " << group.cpu.cpu;
+        line << " instructions: " << group.cpu.sim_instr() << " cycles: " << group.cpu.sim_cycle()
+             << " cumulative IPC: " << std::ceil(group.cpu.sim_instr()) / std::ceil(group.cpu.sim_cycle());
+        line << " (Simulation time: " << elapsed_hour << " hr " << elapsed_minute << " min " << elapsed_second << " sec) " << std::endl;
+        std::cout << line.str() << std::flush;
+      }
+    }
+
+    group.next_quantum.store(quantum + 1, std::memory_order_release);
+  }
+}
+
+void parallel_engine::run_shared()
+{
+  auto end_phase = [this](uint32_t cpu) {
+    for (operable& op : shared_operables)
+      op.end_phase(cpu);
+  };
+
+  auto quantum = first_quantum;
+  for (;; ++quantum) {
+    spin_until([&] {
+      return std::all_of(std::begin(groups), std::end(groups),
+                         [&](const auto& g) { return g->next_quantum.load(std::memory_order_acquire) + config.slack >= quantum; });
+    });
+    if (quantum >= stop_quantum.load(std::memory_order_relaxed))
+      break;
+
+    for (auto& channel : channels)
+      channel->begin_shared_quantum(quantum);
+
+    apply_finished(shared_phase_applied, quantum, end_phase);
+
+    for (uint64_t i = 0; i < config.quantum; ++i) {
+      for (auto& channel : channels)
+        channel->issue();
+
+      for (auto idx : shared_schedule->next()) {
+        try {
+          shared_schedule->at(idx)._operate();
+        } catch (champsim::deadlock& dl) {
+          for (operable& c : shared_operables) {
+            c.print_deadlock();
+            std::cout << std::endl;
+          }
+
+          abort();
+        }
+      }
+      shared_schedule->advance();
+    }
+
+    for (auto& channel : channels)
+      channel->end_shared_quantum(quantum);
+
+    // Once every core has finished, let everyone run to the same quantum
+    auto finished = [quantum](const auto& g) { return g->finish_quantum.load(std::memory_order_acquire) < quantum; };
+    if (stop_quantum.load(std::memory_order_relaxed) == std::numeric_limits<uint64_t>::max() && std::all_of(std::begin(groups), std::end(groups), finished))
+      stop_quantum.store(quantum + config.slack + 1, std::memory_order_release);
+
+    shared_next_quantum.store(quantum + 1, std::memory_order_release);
+  }
+
+  first_quantum = quantum;
+}
+
+void parallel_engine::run_phase(const std::string& phase_name, uint64_t length, const std::function<void(O3_CPU&)>& refill)
+{
+  stop_quantum.store(std::numeric_limits<uint64_t>::max());
+  shared_next_quantum.store(first_quantum);
+  std::fill(std::begin(shared_phase_applied), std::end(shared_phase_applied), false);
+  for (auto& group : groups) {
+    group->next_quantum.store(first_quantum);
+    group->finish_quantum.store(std::numeric_limits<uint64_t>::max());
+    std::fill(std::begin(group->phase_applied), std::end(group->phase_applied), false);
+  }
+
+  std::vector<std::thread> workers;
+  for (auto& group : groups)
+    workers.emplace_back([this, &group = *group, length, &phase_name, &refill] { run_core(group, length, phase_name, refill); });
+
+  run_shared();
+
+  for (auto& worker : workers)
+    worker.join();
+
+  // Deliver any ends of phase that were posted during the final quanta
+  apply_finished(shared_phase_applied, std::numeric_limits<uint64_t>::max(), [this](uint32_t cpu) {
+    for (operable& op : shared_operables)
+      op.end_phase(cpu);
+  });
+  for (auto& group : groups) {
+    apply_finished(group->phase_applied, std::numeric_limits<uint64_t>::max(), [&group](uint32_t cpu) {
+      for (operable& op : group->operables)
+        op.end_phase(cpu);
+    });
+  }
+}
+
+} // namespace champsim
@@ -41,6 +41,11 @@ void champsim::plain_printer::print(O3_CPU::stats_type stats)
   stream << stats.name << " Branch Prediction Accuracy: " << (100.0 * std::ceil(total_branch - total_mispredictions)) / total_branch
          << "% MPKI: " << (1000.0 * total_mispredictions) / std::ceil(stats.instrs());
   stream << " Average ROB Occupancy at Mispredict: " << std::ceil(stats.total_rob_occupancy_at_branch_mispredict) / total_mispredictions << std::endl;
+  for (std::size_t i = 0; i < std::size(stats.end_thread_instrs); ++i) {
+    stream << stats.name << " thread " << i << " cumulative IPC: " << std::ceil(stats.thread_instrs(i)) / std::ceil(stats.cycles())
+           << " instructions: " << stats.thread_instrs(i) << " branch MPKI: " << (1000.0 * std::ceil(stats.thread_branch_misses.at(i))) / std::ceil(stats.thread_instrs(i))
+           << std::endl;
+  }
 
   std::vector<double> mpkis;
   std::transform(std::begin(stats.branch_type_misses), std::end(stats.branch_type_misses), std::back_inserter(mpkis),
@@ -218,6 +223,38 @@ void champsim::plain_printer::print(champsim::phase_stats& stats)
   stream << "DRAM Statistics" << std::endl;
   for (const auto& stat : stats.roi_dram_stats)
     print(stat);
+
+  if (!std::empty(stats.profile.counters))
+    print(stats.profile);
+}
+
+void champsim::plain_printer::print(const host_profile& profile)
+{
+  using seconds = std::chrono::duration<double>;
+  auto total = seconds{profile.total}.count();
+
+  stream << std::endl;
+  stream << "Host Time Profile (whole phase: " << total << " s, timing overhead: " << std::chrono::duration<double, std::nano>{profile.overhead}.count()
+         << " ns/call)" << std::endl;
+
+  auto print_line = [this, total](std::string name, uint64_t calls, double time) {
+    stream << std::left << std::setw(40) << name << std::right;
+    stream << " calls: " << std::setw(12) << calls;
+    stream << "  time: " << std::setw(10) << std::fixed << std::setprecision(3) << time << " s";
+    stream << "  (" << std::setw(5) << std::setprecision(1) << 100 * time / total << "%)";
+    stream << "  ns/call: " << std::setw(8) << std::setprecision(1) << (calls > 0 ? 1e9 * time / calls : 0.0) << std::defaultfloat << std::endl;
+  };
+
+  // Nested counters are included in the time of the counter they are nested within
+  auto outside = total;
+  for (const auto& counter : profile.counters) {
+    print_line(std::string(2 * counter.depth, ' ') + counter.name, counter.calls, seconds{counter.time}.count());
+    if (counter.depth == 0)
+      outside -= seconds{counter.time}.count();
+  }
+  stream << std::left << std::setw(40) << "(scheduling and phase control)" << std::right << "                       ";
+  stream << "  time: " << std::setw(10) << std::fixed << std::setprecision(3) << outside << " s";
+  stream << "  (" << std::setw(5) << std::setprecision(1) << 100 * outside / total << "%)" << std::defaultfloat << std::endl;
 }
 
 void champsim::plain_printer::print(std::vector<phase_stats>& stats)
@@ -24,7 +24,7 @@
 #include "util.h"
 #include "vmem.h"
 
-PageTableWalker::PageTableWalker(std::string v1, uint32_t cpu, double freq_scale, std::vector<std::pair<std::size_t, std::size_t>> pscl_dims, uint32_t v10,
+PageTableWalker::PageTableWalker(std::string v1, uint32_t cpu, champsim::clock_ratio freq_scale, std::vector<std::pair<std::size_t, std::size_t>> pscl_dims, uint32_t v10,
                                  uint32_t v11, uint32_t v12, uint32_t v13, uint64_t latency, MemoryRequestConsumer* ll, VirtualMemory& _vmem)
     : champsim::operable(freq_scale), MemoryRequestProducer(ll), NAME(v1), RQ_SIZE(v10), MSHR_SIZE(v11), MAX_READ(v12), MAX_FILL(v13), HIT_LATENCY(latency),
       vmem(_vmem), CR3_addr(_vmem.get_pte_pa(cpu, 0, std::size(pscl_dims) + 1).first)
@@ -151,6 +151,15 @@ void PageTableWalker::operate()
   RQ.erase(rq_begin, rq_end);
 }
 
+uint64_t PageTableWalker::next_event_cycle() const
+{
+  uint64_t next = std::numeric_limits<uint64_t>::max();
+  for (auto q : {std::cref(MSHR), std::cref(RQ)})
+    if (!std::empty(q.get()))
+      next = std::min(next, q.get().front().event_cycle);
+  return std::max(next, current_cycle);
+}
+
 bool PageTableWalker::add_rq(const PACKET& packet)
 {
   assert(packet.address != 0);
@@ -170,6 +179,40 @@ bool PageTableWalker::add_rq(const PACKET& packet)
   return true;
 }
 
+uint64_t PageTableWalker::functional_access(const functional_request& request)
+{
+  // The same walk as handle_read() and handle_fill(), with every step completing at once
+  const pscl_entry walk_root = {request.address, CR3_addr, std::size(pscl)};
+  auto walk_init = walk_root;
+  for (auto& level : pscl)
+    walk_init = level.check_hit(walk_root).value_or(walk_init);
+
+#if defined ENABLE_PTW_STATS
+  sim_stats.back().total_reads++;
+#endif
+
+  auto step = request;
+  step.v_address = request.address;
+  step.type = TRANSLATION;
+#if defined ENABLE_EXTRA_CACHE_STATS || defined FORCE_HIT
+  step.is_pte = true;
+#endif
+
+  step.address = champsim::splice_bits(walk_init.ptw_addr, vmem.get_offset(request.address, walk_init.level) * PTE_BYTES, LOG2_PAGE_SIZE);
+  for (auto level = walk_init.level; level > 0; --level) {
+    step.translation_level = level;
+    lower_level->functional_access(step);
+
+    auto next_addr = vmem.get_pte_pa(request.cpu, request.address, level).first;
+    pscl.at(std::size(pscl) - level).fill({request.address, next_addr, level - 1});
+    step.address = next_addr;
+  }
+
+  step.translation_level = 0;
+  lower_level->functional_access(step);
+  return vmem.va_to_pa(request.cpu, request.address).first;
+}
+
 void PageTableWalker::return_data(const PACKET& packet)
 {
   for (auto& mshr_entry : MSHR) {
@@ -229,6 +272,13 @@ void PageTableWalker::print_deadlock()
   }
 }
 
+void PageTableWalker::serialize(champsim::checkpoint_archive& ar)
+{
+  ar.expect(std::size(pscl));
+  for (auto& level : pscl)
+    ar.io(level);
+}
+
 void PageTableWalker::begin_phase()
 {
   roi_stats.emplace_back();
@@ -0,0 +1,153 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sampling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace
+{
+constexpr double CONFIDENCE_Z = 1.96; // two-sided 95%, by the normal approximation
+constexpr double TARGET_ERROR = 0.03; // relative error for which the required number of windows is reported
+
+struct estimate {
+  double mean = 0;
+  double half_width = std::numeric_limits<double>::quiet_NaN(); // of the confidence interval, unknown for a single window
+  double variation = std::numeric_limits<double>::quiet_NaN(); // coefficient of variation between windows
+};
+
+estimate estimate_mean(const std::vector<double>& samples)
+{
+  estimate retval;
+  auto n = static_cast<double>(std::size(samples));
+  retval.mean = std::accumulate(std::begin(samples), std::end(samples), 0.0) / n;
+  if (std::size(samples) < 2)
+    return retval;
+
+  auto sum_sq = std::accumulate(std::begin(samples), std::end(samples), 0.0, [mean = retval.mean](auto acc, auto x) { return acc + (x - mean) * (x - mean); });
+  auto stddev = std::sqrt(sum_sq / (n - 1));
+  retval.half_width = CONFIDENCE_Z * stddev / std::sqrt(n);
+  retval.variation = stddev / retval.mean;
+  return retval;
+}
+
+uint64_t total_misses(const CACHE::stats_type& stats, std::size_t cpu)
+{
+  uint64_t retval = 0;
+  for (auto type : {LOAD, RFO, PREFETCH, WRITE, TRANSLATION})
+    retval += stats.misses.at(type).at(cpu);
+  return retval;
+}
+
+uint64_t total_accesses(const CACHE::stats_type& stats, std::size_t cpu)
+{
+  uint64_t retval = total_misses(stats, cpu);
+  for (auto type : {LOAD, RFO, PREFETCH, WRITE, TRANSLATION})
+    retval += stats.hits.at(type).at(cpu);
+  return retval;
+}
+
+double mpki(uint64_t events, uint64_t instrs) { return 1000.0 * std::ceil(events) / std::ceil(instrs); }
+} // namespace
+
+std::vector<champsim::phase_info> champsim::sampled_phases(const sampling_config& config, uint64_t region_length, const std::vector<std::string>& trace_names)
+{
+  if (config.length == 0 || config.interval < config.warmup + config.length)
+    throw std::invalid_argument("The sampling interval must hold the detailed warmup and the measured window");
+  if (region_length < config.interval)
+    throw std::invalid_argument("The simulated region is shorter than one sampling interval");
+
+  std::vector<phase_info> retval;
+  const auto fast_forward = config.interval - config.warmup - config.length;
+  for (uint64_t unit = 0; unit < region_length / config.interval; ++unit) {
+    if (fast_forward > 0) {
+      retval.push_back(phase_info{"Fast-forward " + std::to_string(unit), true, fast_forward, trace_names});
+      retval.back().is_functional = true;
+    }
+    if (config.warmup > 0) {
+      retval.push_back(phase_info{"Sample warmup " + std::to_string(unit), true, config.warmup, trace_names});
+      retval.back().is_timed = true;
+    }
+    retval.push_back(phase_info{"Sample " + std::to_string(unit), false, config.length, trace_names});
+  }
+
+  return retval;
+}
+
+void champsim::print_sampling_report(std::ostream& stream, const std::vector<phase_stats>& windows)
+{
+  if (std::empty(windows))
+    return;
+
+  const auto num_cpus = std::size(windows.front().roi_cpu_stats);
+  const auto num_caches = std::size(windows.front().roi_cache_stats);
+
+  stream << std::endl;
+  for (const auto& window : windows) {
+    for (std::size_t cpu = 0; cpu < num_cpus; ++cpu) {
+      const auto& cpu_stats = window.roi_cpu_stats.at(cpu);
+      auto branch_misses = std::accumulate(std::begin(cpu_stats.branch_type_misses), std::end(cpu_stats.branch_type_misses), 0ll);
+
+      stream << window.name << " " << cpu_stats.name << " instructions: " << cpu_stats.instrs() << " cycles: " << cpu_stats.cycles();
+      stream << " IPC: " << std::ceil(cpu_stats.instrs()) / std::ceil(cpu_stats.cycles());
+      stream << " branch MPKI: " << mpki(branch_misses, cpu_stats.instrs());
+      for (const auto& cache_stats : window.roi_cache_stats)
+        if (total_accesses(cache_stats, cpu) > 0)
+          stream << " " << cache_stats.name << " MPKI: " << mpki(total_misses(cache_stats, cpu), cpu_stats.instrs());
+      stream << std::endl;
+    }
+  }
+
+  for (std::size_t cpu = 0; cpu < num_cpus; ++cpu) {
+    std::vector<double> cpi, branch_mpki;
+    std::vector<std::vector<double>> cache_mpki(num_caches);
+    std::vector<bool> cache_used(num_caches, false);
+    for (const auto& window : windows) {
+      const auto& cpu_stats = window.roi_cpu_stats.at(cpu);
+      cpi.push_back(std::ceil(cpu_stats.cycles()) / std::ceil(cpu_stats.instrs()));
+      branch_mpki.push_back(
+          mpki(std::accumulate(std::begin(cpu_stats.branch_type_misses), std::end(cpu_stats.branch_type_misses), 0ll), cpu_stats.instrs()));
+      for (std::size_t i = 0; i < num_caches; ++i) {
+        cache_mpki[i].push_back(mpki(total_misses(window.roi_cache_stats.at(i), cpu), cpu_stats.instrs()));
+        cache_used[i] = cache_used[i] || total_accesses(window.roi_cache_stats.at(i), cpu) > 0;
+      }
+    }
+
+    // The windows are of equal length, so the mean CPI is that of the whole sample
+    const auto& name = windows.front().roi_cpu_stats.at(cpu).name;
+    auto est_cpi = estimate_mean(cpi);
+    stream << std::endl;
+    stream << name << " sampled IPC: " << 1.0 / est_cpi.mean << " +/- " << 100.0 * est_cpi.half_width / est_cpi.mean << "% (95% confidence, "
+           << std::size(windows) << " windows";
+    if (!std::isnan(est_cpi.variation))
+      stream << "; " << std::ceil(std::pow(CONFIDENCE_Z * est_cpi.variation / TARGET_ERROR, 2)) << " needed for +/- " << 100.0 * TARGET_ERROR << "%";
+    stream << ")" << std::endl;
+
+    auto est_branch = estimate_mean(branch_mpki);
+    stream << name << " sampled branch MPKI: " << est_branch.mean << " +/- " << est_branch.half_width << std::endl;
+    for (std::size_t i = 0; i < num_caches; ++i) {
+      if (cache_used[i]) {
+        auto est_cache = estimate_mean(cache_mpki[i]);
+        stream << name << " sampled " << windows.front().roi_cache_stats.at(i).name << " MPKI: " << est_cache.mean << " +/- " << est_cache.half_width
+               << std::endl;
+      }
+    }
+  }
+}
@@ -0,0 +1,345 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "trace_format.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+constexpr std::size_t BUFFER_SIZE = 1 << 16;
+
+// header, ip, registers, addresses, and pages with their base VPNs
+constexpr std::size_t MAX_RECORD_SIZE = 3 + 10 + NUM_INSTR_DESTINATIONS + NUM_INSTR_SOURCES + 10 * (NUM_INSTR_DESTINATIONS + NUM_INSTR_SOURCES)
+                                        + 11 * (1 + NUM_INSTR_DESTINATIONS + NUM_INSTR_SOURCES);
+
+constexpr uint8_t FLAG_BRANCH = 0x1, FLAG_TAKEN = 0x2, FLAG_PAGES = 0x4;   // version 1
+constexpr uint8_t REGS_BRANCH = 0x40, REGS_TAKEN = 0x80, MEMS_PAGES = 0x40; // version 2
+constexpr unsigned SOURCE_SHIFT = 2;                                      // of the source slots in the bitmaps and counts
+constexpr uint8_t PAGE_EXPLICIT_VPN = 0x80;
+
+void put_varint(std::vector<uint8_t>& buf, uint64_t value)
+{
+  for (; value >= 0x80; value >>= 7)
+    buf.push_back(static_cast<uint8_t>(value | 0x80));
+  buf.push_back(static_cast<uint8_t>(value));
+}
+
+// Small differences of either sign are encoded in few bytes
+uint64_t zigzag(uint64_t delta) { return (delta << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(delta) >> 63); }
+uint64_t unzigzag(uint64_t value) { return (value >> 1) ^ (~(value & 1) + 1); }
+
+uint64_t default_vpn(uint8_t size, uint64_t addr)
+{
+  if (size == 0)
+    return 0;
+  return addr >> (size == champsim::LARGE_PAGE ? champsim::LARGE_PAGE_BITS : champsim::SMALL_PAGE_BITS);
+}
+
+void put_page(std::vector<uint8_t>& buf, champsim::page_info page, uint64_t addr)
+{
+  if (page.base_vpn == default_vpn(page.size, addr)) {
+    buf.push_back(page.size);
+  } else {
+    buf.push_back(page.size | PAGE_EXPLICIT_VPN);
+    put_varint(buf, page.base_vpn);
+  }
+}
+
+bool has_page(champsim::page_info page) { return page.size != 0 || page.base_vpn != 0; }
+
+// Reads a record from the buffer. Unless `Checked`, the buffer is known to hold a whole record, so that no byte is bounds-checked.
+template <bool Checked>
+class record_parser
+{
+  const uint8_t* it;
+  const uint8_t* const last;
+
+public:
+  record_parser(const uint8_t* begin, const uint8_t* end) : it(begin), last(end) {}
+
+  const uint8_t* position() const { return it; }
+
+  uint8_t byte()
+  {
+    if constexpr (Checked) {
+      if (it == last)
+        throw std::runtime_error("Packed trace is truncated");
+    }
+    return *it++;
+  }
+
+  // Present slots take the next byte, and absent ones are left zero, without a branch on each slot
+  template <std::size_t N>
+  void bytes(unsigned char (&slots)[N], unsigned mask)
+  {
+    for (std::size_t i = 0; i < N; ++i) {
+      auto present = (mask >> i) & 1;
+      if constexpr (Checked) {
+        if (present && it == last)
+          throw std::runtime_error("Packed trace is truncated");
+      }
+      slots[i] = present ? *it : 0;
+      it += present;
+    }
+  }
+
+  uint64_t varint()
+  {
+    uint64_t retval = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+      auto b = byte();
+      retval |= static_cast<uint64_t>(b & 0x7f) << shift;
+      if ((b & 0x80) == 0)
+        return retval;
+    }
+    throw std::runtime_error("Packed trace is corrupt");
+  }
+
+  champsim::page_info page(uint64_t addr)
+  {
+    auto b = byte();
+    champsim::page_info retval{static_cast<uint8_t>(b & ~PAGE_EXPLICIT_VPN), 0};
+    retval.base_vpn = (b & PAGE_EXPLICIT_VPN) ? varint() : default_vpn(retval.size, addr);
+    return retval;
+  }
+};
+} // namespace
+
+champsim::packed_trace_writer::packed_trace_writer(std::ostream& stream, uint8_t ver) : out(stream), version(ver)
+{
+  if (version != 1 && version != 2)
+    throw std::invalid_argument("Packed trace version " + std::to_string(version) + " is not supported");
+  out.write(std::data(PACKED_TRACE_MAGIC), std::size(PACKED_TRACE_MAGIC));
+  out.put(static_cast<char>(version));
+}
+
+champsim::packed_trace_writer::~packed_trace_writer() { out.write(reinterpret_cast<const char*>(std::data(buffer)), static_cast<std::streamsize>(std::size(buffer))); }
+
+void champsim::packed_trace_writer::write(const packed_instr& instr)
+{
+  if (version == 1)
+    write_v1(instr);
+  else
+    write_v2(instr);
+
+  if (std::size(buffer) >= BUFFER_SIZE) {
+    out.write(reinterpret_cast<const char*>(std::data(buffer)), static_cast<std::streamsize>(std::size(buffer)));
+    buffer.clear();
+  }
+}
+
+void champsim::packed_trace_writer::write_v1(const packed_instr& instr)
+{
+  std::vector<uint8_t> dst_regs, src_regs;
+  std::copy_if(std::begin(instr.instr.destination_registers), std::end(instr.instr.destination_registers), std::back_inserter(dst_regs), [](auto r) { return r != 0; });
+  std::copy_if(std::begin(instr.instr.source_registers), std::end(instr.instr.source_registers), std::back_inserter(src_regs), [](auto r) { return r != 0; });
+
+  std::vector<std::pair<uint64_t, page_info>> dst_mem, src_mem;
+  for (std::size_t i = 0; i < NUM_INSTR_DESTINATIONS; ++i)
+    if (instr.instr.destination_memory[i] != 0)
+      dst_mem.emplace_back(instr.instr.destination_memory[i], instr.destination_pages[i]);
+  for (std::size_t i = 0; i < NUM_INSTR_SOURCES; ++i)
+    if (instr.instr.source_memory[i] != 0)
+      src_mem.emplace_back(instr.instr.source_memory[i], instr.source_pages[i]);
+
+  auto has_pages = has_page(instr.ip_page);
+  for (const auto& [addr, page] : dst_mem)
+    has_pages = has_pages || has_page(page);
+  for (const auto& [addr, page] : src_mem)
+    has_pages = has_pages || has_page(page);
+
+  uint8_t flags = (instr.instr.is_branch ? FLAG_BRANCH : 0) | (instr.instr.branch_taken ? FLAG_TAKEN : 0) | (has_pages ? FLAG_PAGES : 0);
+  buffer.push_back(flags);
+  buffer.push_back(static_cast<uint8_t>(std::size(dst_regs) | (std::size(src_regs) << SOURCE_SHIFT)));
+  buffer.push_back(static_cast<uint8_t>(std::size(dst_mem) | (std::size(src_mem) << SOURCE_SHIFT)));
+  put_varint(buffer, instr.instr.ip);
+  buffer.insert(std::end(buffer), std::begin(dst_regs), std::end(dst_regs));
+  buffer.insert(std::end(buffer), std::begin(src_regs), std::end(src_regs));
+  for (const auto& [addr, page] : dst_mem)
+    put_varint(buffer, addr);
+  for (const auto& [addr, page] : src_mem)
+    put_varint(buffer, addr);
+
+  if (has_pages) {
+    put_page(buffer, instr.ip_page, instr.instr.ip);
+    for (const auto& [addr, page] : dst_mem)
+      put_page(buffer, page, addr);
+    for (const auto& [addr, page] : src_mem)
+      put_page(buffer, page, addr);
+  }
+}
+
+void champsim::packed_trace_writer::write_v2(const packed_instr& instr)
+{
+  uint8_t regs = (instr.instr.is_branch ? REGS_BRANCH : 0) | (instr.instr.branch_taken ? REGS_TAKEN : 0);
+  uint8_t mems = 0;
+  auto has_pages = has_page(instr.ip_page);
+  for (std::size_t i = 0; i < NUM_INSTR_DESTINATIONS; ++i) {
+    regs |= (instr.instr.destination_registers[i] != 0) << i;
+    mems |= (instr.instr.destination_memory[i] != 0) << i;
+    has_pages = has_pages || (instr.instr.destination_memory[i] != 0 && has_page(instr.destination_pages[i]));
+  }
+  for (std::size_t i = 0; i < NUM_INSTR_SOURCES; ++i) {
+    regs |= (instr.instr.source_registers[i] != 0) << (i + SOURCE_SHIFT);
+    mems |= (instr.instr.source_memory[i] != 0) << (i + SOURCE_SHIFT);
+    has_pages = has_pages || (instr.instr.source_memory[i] != 0 && has_page(instr.source_pages[i]));
+  }
+
+  buffer.push_back(regs);
+  buffer.push_back(mems | (has_pages ? MEMS_PAGES : 0));
+  put_varint(buffer, zigzag(instr.instr.ip - last.ip));
+  last.ip = instr.instr.ip;
+
+  std::copy_if(std::begin(instr.instr.destination_registers), std::end(instr.instr.destination_registers), std::back_inserter(buffer), [](auto r) { return r != 0; });
+  std::copy_if(std::begin(instr.instr.source_registers), std::end(instr.instr.source_registers), std::back_inserter(buffer), [](auto r) { return r != 0; });
+  for (auto addr : instr.instr.destination_memory) {
+    if (addr != 0) {
+      put_varint(buffer, zigzag(addr - last.destination));
+      last.destination = addr;
+    }
+  }
+  for (auto addr : instr.instr.source_memory) {
+    if (addr != 0) {
+      put_varint(buffer, zigzag(addr - last.source));
+      last.source = addr;
+    }
+  }
+
+  if (has_pages) {
+    put_page(buffer, instr.ip_page, instr.instr.ip);
+    for (std::size_t i = 0; i < NUM_INSTR_DESTINATIONS; ++i)
+      if (instr.instr.destination_memory[i] != 0)
+        put_page(buffer, instr.destination_pages[i], instr.instr.destination_memory[i]);
+    for (std::size_t i = 0; i < NUM_INSTR_SOURCES; ++i)
+      if (instr.instr.source_memory[i] != 0)
+        put_page(buffer, instr.source_pages[i], instr.instr.source_memory[i]);
+  }
+}
+
+champsim::packed_trace_reader::packed_trace_reader(std::unique_ptr<trace_source> src, uint8_t ver) : source(std::move(src)), buffer(BUFFER_SIZE), version(ver)
+{
+  if (version != 1 && version != 2)
+    throw std::runtime_error("Packed trace version " + std::to_string(version) + " is not supported");
+}
+
+bool champsim::packed_trace_reader::fill()
+{
+  std::copy(std::next(std::begin(buffer), static_cast<long>(position)), std::next(std::begin(buffer), static_cast<long>(end)), std::begin(buffer));
+  end -= position;
+  position = 0;
+
+  auto bytes_read = source->read(reinterpret_cast<char*>(std::data(buffer)) + end, std::size(buffer) - end);
+  source_ended = bytes_read < std::size(buffer) - end;
+  end += bytes_read;
+  return end > 0;
+}
+
+bool champsim::packed_trace_reader::read(packed_instr& instr)
+{
+  if (end - position < MAX_RECORD_SIZE && !source_ended)
+    fill();
+  if (position == end)
+    return false;
+
+  instr = packed_instr{};
+  const uint8_t* next;
+  if (end - position >= MAX_RECORD_SIZE) {
+    record_parser<false> parse{std::data(buffer) + position, std::data(buffer) + end};
+    version == 1 ? read_v1(parse, instr) : read_v2(parse, instr);
+    next = parse.position();
+  } else {
+    record_parser<true> parse{std::data(buffer) + position, std::data(buffer) + end};
+    version == 1 ? read_v1(parse, instr) : read_v2(parse, instr);
+    next = parse.position();
+  }
+
+  position = static_cast<std::size_t>(next - std::data(buffer));
+  return true;
+}
+
+template <typename Parser>
+void champsim::packed_trace_reader::read_v1(Parser& parse, packed_instr& instr)
+{
+  auto flags = parse.byte();
+  auto regs = parse.byte();
+  auto mems = parse.byte();
+  std::size_t num_dst_regs = regs & 0x3, num_src_regs = (regs >> SOURCE_SHIFT) & 0x7;
+  std::size_t num_dst_mem = mems & 0x3, num_src_mem = (mems >> SOURCE_SHIFT) & 0x7;
+  if (num_dst_regs > NUM_INSTR_DESTINATIONS || num_src_regs > NUM_INSTR_SOURCES || num_dst_mem > NUM_INSTR_DESTINATIONS || num_src_mem > NUM_INSTR_SOURCES)
+    throw std::runtime_error("Packed trace is corrupt");
+
+  instr.instr.is_branch = (flags & FLAG_BRANCH) != 0;
+  instr.instr.branch_taken = (flags & FLAG_TAKEN) != 0;
+  instr.instr.ip = parse.varint();
+  for (std::size_t i = 0; i < num_dst_regs; ++i)
+    instr.instr.destination_registers[i] = parse.byte();
+  for (std::size_t i = 0; i < num_src_regs; ++i)
+    instr.instr.source_registers[i] = parse.byte();
+  for (std::size_t i = 0; i < num_dst_mem; ++i)
+    instr.instr.destination_memory[i] = parse.varint();
+  for (std::size_t i = 0; i < num_src_mem; ++i)
+    instr.instr.source_memory[i] = parse.varint();
+
+  if (flags & FLAG_PAGES) {
+    instr.ip_page = parse.page(instr.instr.ip);
+    for (std::size_t i = 0; i < num_dst_mem; ++i)
+      instr.destination_pages[i] = parse.page(instr.instr.destination_memory[i]);
+    for (std::size_t i = 0; i < num_src_mem; ++i)
+      instr.source_pages[i] = parse.page(instr.instr.source_memory[i]);
+  }
+}
+
+template <typename Parser>
+void champsim::packed_trace_reader::read_v2(Parser& parse, packed_instr& instr)
+{
+  auto regs = parse.byte();
+  auto mems = parse.byte();
+
+  instr.instr.is_branch = (regs & REGS_BRANCH) != 0;
+  instr.instr.branch_taken = (regs & REGS_TAKEN) != 0;
+  last.ip += unzigzag(parse.varint());
+  instr.instr.ip = last.ip;
+  parse.bytes(instr.instr.destination_registers, regs);
+  parse.bytes(instr.instr.source_registers, regs >> SOURCE_SHIFT);
+
+  for (std::size_t i = 0; i < NUM_INSTR_DESTINATIONS; ++i) {
+    if (mems & (1u << i)) {
+      last.destination += unzigzag(parse.varint());
+      instr.instr.destination_memory[i] = last.destination;
+    }
+  }
+  for (std::size_t i = 0; i < NUM_INSTR_SOURCES; ++i) {
+    if (mems & (1u << (i + SOURCE_SHIFT))) {
+      last.source += unzigzag(parse.varint());
+      instr.instr.source_memory[i] = last.source;
+    }
+  }
+
+  if (mems & MEMS_PAGES) {
+    instr.ip_page = parse.page(instr.instr.ip);
+    for (std::size_t i = 0; i < NUM_INSTR_DESTINATIONS; ++i)
+      if (instr.instr.destination_memory[i] != 0)
+        instr.destination_pages[i] = parse.page(instr.instr.destination_memory[i]);
+    for (std::size_t i = 0; i < NUM_INSTR_SOURCES; ++i)
+      if (instr.instr.source_memory[i] != 0)
+        instr.source_pages[i] = parse.page(instr.instr.source_memory[i]);
+  }
+}
@@ -0,0 +1,507 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "trace_source.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <lzma.h>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include <zlib.h>
+
+#include "trace_server.h"
+
+unsigned champsim::trace_decoder_threads = 1;
+std::string champsim::trace_server_socket;
+
+namespace
+{
+constexpr std::size_t INPUT_BUFFER_SIZE = 1 << 20;
+
+using file_ptr = std::unique_ptr<FILE, void (*)(FILE*)>;
+
+bool has_extension(const std::string& fname, const std::string& ext)
+{
+  return std::size(fname) > std::size(ext) && fname.compare(std::size(fname) - std::size(ext), std::string::npos, ext) == 0;
+}
+
+file_ptr open_file(const std::string& fname)
+{
+  file_ptr retval{std::fopen(fname.c_str(), "rb"), [](FILE* f) { std::fclose(f); }};
+  if (retval == nullptr)
+    throw std::runtime_error("Could not open trace " + fname);
+  return retval;
+}
+
+// The output of the commands that read and decompress the trace
+FILE* open_command(const std::string& fname)
+{
+  std::string cmd_fmtstr = "%1$s %2$s";
+  if (fname.substr(0, 4) == "http")
+    cmd_fmtstr = "wget -qO- -o /dev/null %2$s | %1$s";
+
+  std::string decomp_program = "cat";
+  if (fname.back() == 'z') {
+    std::string last_dot = fname.substr(fname.find_last_of("."));
+    if (last_dot[1] == 'g') // gzip format
+      decomp_program = "gzip -dc";
+    else if (last_dot[1] == 'x') // xz
+      decomp_program = "xz -dc";
+  }
+
+  char gunzip_command[4096];
+  snprintf(gunzip_command, std::size(gunzip_command), cmd_fmtstr.c_str(), decomp_program.c_str(), fname.c_str());
+  return popen(gunzip_command, "r");
+}
+
+// Uncompressed files, and the output of decompression commands
+class file_source : public champsim::trace_source
+{
+  file_ptr fp;
+
+public:
+  explicit file_source(file_ptr file) : fp(std::move(file)) {}
+  std::size_t read(char* buf, std::size_t size) override { return std::fread(buf, 1, size, fp.get()); }
+  uint64_t skip(uint64_t size) override;
+};
+
+class xz_source : public champsim::trace_source
+{
+  const std::string name;
+  file_ptr fp;
+  std::vector<uint8_t> inbuf = std::vector<uint8_t>(INPUT_BUFFER_SIZE);
+  lzma_stream strm = LZMA_STREAM_INIT;
+  bool finished = false;
+  uint64_t position = 0; // in the decompressed trace
+
+  // After a seek, the blocks are decoded one at a time in the order of the index
+  lzma_index* index = nullptr;
+  lzma_index_iter block_iter;
+  bool by_block = false;
+
+  bool load_index();
+  void begin_block();
+
+public:
+  explicit xz_source(const std::string& fname);
+  ~xz_source();
+  std::size_t read(char* buf, std::size_t size) override;
+  uint64_t skip(uint64_t size) override;
+};
+
+class gzip_source : public champsim::trace_source
+{
+  const std::string name;
+  file_ptr fp;
+  std::vector<uint8_t> inbuf = std::vector<uint8_t>(INPUT_BUFFER_SIZE);
+  z_stream strm{};
+  bool finished = false;
+
+  bool refill();
+
+public:
+  explicit gzip_source(const std::string& fname);
+  ~gzip_source() { inflateEnd(&strm); }
+  std::size_t read(char* buf, std::size_t size) override;
+};
+
+std::unique_ptr<champsim::trace_source> open_local(const std::string& fname);
+
+// A trace decompressed by the trace server into shared memory
+class shared_source : public champsim::trace_source
+{
+  const std::string name;
+  int connection;
+  const uint8_t* mapping = nullptr;
+  std::size_t mapping_size = 0;
+  uint64_t position = 0;
+
+  // Should the server fail to finish the trace, the rest of it is decompressed here
+  std::unique_ptr<champsim::trace_source> fallback;
+
+  const champsim::trace_server::shared_header& header() const { return *reinterpret_cast<const champsim::trace_server::shared_header*>(mapping); }
+  uint64_t wait_for(uint64_t end);
+
+public:
+  shared_source(const std::string& fname, int conn, const uint8_t* map, std::size_t map_size)
+      : name(fname), connection(conn), mapping(map), mapping_size(map_size)
+  {
+  }
+  ~shared_source();
+  std::size_t read(char* buf, std::size_t size) override;
+  uint64_t skip(uint64_t size) override;
+};
+} // namespace
+
+uint64_t champsim::trace_source::skip(uint64_t size)
+{
+  std::vector<char> discard(std::min<uint64_t>(size, INPUT_BUFFER_SIZE));
+  uint64_t retval = 0;
+  while (retval < size) {
+    auto bytes_read = read(std::data(discard), static_cast<std::size_t>(std::min<uint64_t>(size - retval, std::size(discard))));
+    retval += bytes_read;
+    if (bytes_read == 0)
+      break;
+  }
+  return retval;
+}
+
+uint64_t file_source::skip(uint64_t size)
+{
+  // Pipes cannot seek
+  struct stat status;
+  auto here = ftello(fp.get());
+  if (fstat(fileno(fp.get()), &status) != 0 || !S_ISREG(status.st_mode) || here < 0)
+    return trace_source::skip(size);
+
+  auto retval = std::min<uint64_t>(size, static_cast<uint64_t>(std::max<off_t>(status.st_size - here, 0)));
+  fseeko(fp.get(), static_cast<off_t>(here + static_cast<off_t>(retval)), SEEK_SET);
+  return retval;
+}
+
+xz_source::xz_source(const std::string& fname) : name(fname), fp(open_file(fname))
+{
+  lzma_ret ret;
+#if LZMA_VERSION >= 50040002
+  if (champsim::trace_decoder_threads > 1) {
+    // Blocks are decompressed in parallel only if the file has several, as written by `xz -T`
+    lzma_mt options{};
+    options.flags = LZMA_CONCATENATED;
+    options.threads = champsim::trace_decoder_threads;
+    options.memlimit_threading = lzma_physmem() / 4;
+    options.memlimit_stop = UINT64_MAX;
+    ret = lzma_stream_decoder_mt(&strm, &options);
+  } else
+#endif
+    ret = lzma_stream_decoder(&strm, UINT64_MAX, LZMA_CONCATENATED);
+
+  if (ret != LZMA_OK)
+    throw std::runtime_error("Could not begin to decompress trace " + name);
+}
+
+xz_source::~xz_source()
+{
+  lzma_end(&strm);
+  lzma_index_end(index, nullptr);
+}
+
+std::size_t xz_source::read(char* buf, std::size_t size)
+{
+  strm.next_out = reinterpret_cast<uint8_t*>(buf);
+  strm.avail_out = size;
+  while (strm.avail_out > 0 && !finished) {
+    if (strm.avail_in == 0) {
+      strm.next_in = std::data(inbuf);
+      strm.avail_in = std::fread(std::data(inbuf), 1, std::size(inbuf), fp.get());
+    }
+
+    auto ret = lzma_code(&strm, strm.avail_in == 0 ? LZMA_FINISH : LZMA_RUN);
+    if (ret == LZMA_STREAM_END) {
+      finished = !by_block || lzma_index_iter_next(&block_iter, LZMA_INDEX_ITER_NONEMPTY_BLOCK);
+      if (!finished)
+        begin_block();
+    } else if (ret != LZMA_OK) {
+      throw std::runtime_error("Could not decompress trace " + name + " (liblzma error " + std::to_string(ret) + ")");
+    }
+  }
+
+  position += size - strm.avail_out;
+  return size - strm.avail_out;
+}
+
+// Reads the index from the end of each stream in the file
+bool xz_source::load_index()
+{
+#if LZMA_VERSION >= 50040002
+  if (index != nullptr)
+    return true;
+  if (fseeko(fp.get(), 0, SEEK_END) != 0)
+    return false;
+  auto file_size = ftello(fp.get());
+
+  lzma_stream info = LZMA_STREAM_INIT;
+  auto ret = lzma_file_info_decoder(&info, &index, UINT64_MAX, static_cast<uint64_t>(file_size));
+  std::vector<uint8_t> buf(INPUT_BUFFER_SIZE);
+  uint64_t seek_pos = 0;
+  while (ret == LZMA_OK || ret == LZMA_SEEK_NEEDED) {
+    if (ret == LZMA_SEEK_NEEDED || info.avail_in == 0) {
+      if (ret == LZMA_SEEK_NEEDED)
+        seek_pos = info.seek_pos;
+      fseeko(fp.get(), static_cast<off_t>(seek_pos), SEEK_SET);
+      info.next_in = std::data(buf);
+      info.avail_in = std::fread(std::data(buf), 1, std::size(buf), fp.get());
+      seek_pos += info.avail_in;
+    }
+    ret = lzma_code(&info, LZMA_RUN);
+  }
+  lzma_end(&info);
+
+  if (ret != LZMA_STREAM_END)
+    index = nullptr;
+  return index != nullptr;
+#else
+  return false;
+#endif
+}
+
+// Positions the file at the block under the iterator and decodes it alone
+void xz_source::begin_block()
+{
+  std::array<uint8_t, LZMA_BLOCK_HEADER_SIZE_MAX> header;
+  std::array<lzma_filter, LZMA_FILTERS_MAX + 1> filters;
+  lzma_block block{};
+  block.version = 1;
+  block.check = block_iter.stream.flags->check;
+  block.filters = std::data(filters);
+
+  fseeko(fp.get(), static_cast<off_t>(block_iter.block.compressed_file_offset), SEEK_SET);
+  strm.avail_in = 0;
+  if (std::fread(std::data(header), 1, 1, fp.get()) != 1)
+    throw std::runtime_error("Trace " + name + " is truncated");
+  block.header_size = lzma_block_header_size_decode(header[0]);
+  if (std::fread(std::next(std::data(header)), 1, block.header_size - 1, fp.get()) != block.header_size - 1)
+    throw std::runtime_error("Trace " + name + " is truncated");
+
+  auto ret = lzma_block_header_decode(&block, nullptr, std::data(header));
+  if (ret == LZMA_OK)
+    ret = lzma_block_compressed_size(&block, block_iter.block.unpadded_size);
+  if (ret == LZMA_OK)
+    ret = lzma_block_decoder(&strm, &block);
+  for (auto& filter : filters) {
+    if (filter.id == LZMA_VLI_UNKNOWN)
+      break;
+    std::free(filter.options);
+  }
+
+  if (ret != LZMA_OK)
+    throw std::runtime_error("Could not decompress trace " + name + " (liblzma error " + std::to_string(ret) + ")");
+}
+
+uint64_t xz_source::skip(uint64_t size)
+{
+  // Within a single block, every byte before the target must be decoded anyway
+  auto here = ftello(fp.get());
+  auto seekable = load_index() && lzma_index_block_count(index) > 1;
+  fseeko(fp.get(), here, SEEK_SET);
+  if (!seekable)
+    return trace_source::skip(size);
+
+  auto target = position + size;
+  if (target >= lzma_index_uncompressed_size(index)) {
+    finished = true;
+    auto retval = lzma_index_uncompressed_size(index) - position;
+    position = lzma_index_uncompressed_size(index);
+    return retval;
+  }
+
+  lzma_index_iter_init(&block_iter, index);
+  lzma_index_iter_locate(&block_iter, target);
+  by_block = true;
+  finished = false;
+  begin_block();
+
+  position = block_iter.block.uncompressed_file_offset;
+  trace_source::skip(target - position);
+  return size;
+}
+
+gzip_source::gzip_source(const std::string& fname) : name(fname), fp(open_file(fname))
+{
+  // Accept either a gzip or a zlib header
+  if (inflateInit2(&strm, 15 + 32) != Z_OK)
+    throw std::runtime_error("Could not begin to decompress trace " + name);
+}
+
+bool gzip_source::refill()
+{
+  strm.next_in = std::data(inbuf);
+  strm.avail_in = static_cast<uInt>(std::fread(std::data(inbuf), 1, std::size(inbuf), fp.get()));
+  return strm.avail_in > 0;
+}
+
+std::size_t gzip_source::read(char* buf, std::size_t size)
+{
+  strm.next_out = reinterpret_cast<Bytef*>(buf);
+  strm.avail_out = static_cast<uInt>(size);
+  while (strm.avail_out > 0 && !finished) {
+    if (strm.avail_in == 0 && !refill())
+      throw std::runtime_error("Trace " + name + " is truncated");
+
+    auto ret = inflate(&strm, Z_NO_FLUSH);
+    if (ret == Z_STREAM_END) {
+      // Like gzip -d, continue into any member that follows
+      if (strm.avail_in > 0 || refill())
+        inflateReset(&strm);
+      else
+        finished = true;
+    } else if (ret != Z_OK) {
+      throw std::runtime_error("Could not decompress trace " + name + " (zlib error " + std::to_string(ret) + ")");
+    }
+  }
+
+  return size - strm.avail_out;
+}
+
+shared_source::~shared_source()
+{
+  munmap(const_cast<uint8_t*>(mapping), mapping_size);
+  close(connection);
+}
+
+// Returns how much of the trace up to `end` the server has written, once it has written all of it or finished
+uint64_t shared_source::wait_for(uint64_t end)
+{
+  using namespace champsim::trace_server;
+  while (true) {
+    auto state = header().state.load(std::memory_order_acquire);
+    auto available = header().available.load(std::memory_order_acquire);
+    if (available >= end || state == COMPLETE)
+      return std::min(available, end);
+
+    // A server that exits closes the connection
+    pollfd pfd{connection, POLLIN, 0};
+    if (state == FAILED || poll(&pfd, 1, 0) != 0) {
+      fallback = open_local(name);
+      if (fallback->skip(position) != position)
+        throw std::runtime_error("Trace " + name + " changed while it was read");
+      return position;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds{100});
+  }
+}
+
+std::size_t shared_source::read(char* buf, std::size_t size)
+{
+  std::size_t retval = 0;
+  while (retval < size && fallback == nullptr) {
+    auto available = wait_for(position + size - retval);
+    if (available == position)
+      break;
+    std::memcpy(buf + retval, mapping + champsim::trace_server::DATA_OFFSET + position, available - position);
+    retval += available - position;
+    position = available;
+  }
+
+  if (fallback != nullptr && retval < size)
+    retval += fallback->read(buf + retval, size - retval);
+  return retval;
+}
+
+uint64_t shared_source::skip(uint64_t size)
+{
+  if (fallback != nullptr)
+    return fallback->skip(size);
+
+  auto available = wait_for(position + size);
+  auto retval = available - position;
+  position = available;
+  if (fallback != nullptr)
+    retval += fallback->skip(size - retval);
+  return retval;
+}
+
+namespace
+{
+// Returns nullptr if the server is not running or does not serve the trace
+std::unique_ptr<champsim::trace_source> attach_server(const std::string& socket_path, const std::string& fname)
+{
+  std::string request = fname;
+  if (fname.substr(0, 4) != "http") {
+    std::unique_ptr<char, void (*)(void*)> resolved{realpath(fname.c_str(), nullptr), std::free};
+    if (resolved == nullptr)
+      return nullptr;
+    request = resolved.get();
+  }
+  request += "\n";
+
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (std::size(socket_path) >= sizeof(address.sun_path))
+    return nullptr;
+  std::strcpy(address.sun_path, socket_path.c_str());
+
+  int connection = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (connection < 0)
+    return nullptr;
+  std::unique_ptr<int, void (*)(int*)> guard{&connection, [](int* fd) { close(*fd); }};
+  if (connect(connection, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+      || write(connection, request.c_str(), std::size(request)) != static_cast<ssize_t>(std::size(request)))
+    return nullptr;
+
+  std::string reply;
+  char c;
+  while (read(connection, &c, 1) == 1 && c != '\n')
+    reply.push_back(c);
+  if (reply.substr(0, 3) != "OK ") {
+    std::cout << "Trace server does not serve " << fname << ": " << reply << std::endl;
+    return nullptr;
+  }
+
+  int shm = shm_open(reply.substr(3).c_str(), O_RDONLY, 0);
+  if (shm < 0)
+    return nullptr;
+  struct stat status;
+  void* mapping = MAP_FAILED;
+  if (fstat(shm, &status) == 0)
+    mapping = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_SHARED, shm, 0);
+  close(shm);
+  if (mapping == MAP_FAILED)
+    return nullptr;
+
+  guard.release();
+  return std::make_unique<shared_source>(fname, connection, static_cast<const uint8_t*>(mapping), static_cast<std::size_t>(status.st_size));
+}
+
+std::unique_ptr<champsim::trace_source> open_local(const std::string& fname)
+{
+  if (fname.substr(0, 4) != "http") {
+    if (has_extension(fname, ".xz"))
+      return std::make_unique<xz_source>(fname);
+    if (has_extension(fname, ".gz"))
+      return std::make_unique<gzip_source>(fname);
+    if (fname.back() != 'z')
+      return std::make_unique<file_source>(open_file(fname));
+  }
+
+  return std::make_unique<file_source>(file_ptr{open_command(fname), [](FILE* f) { pclose(f); }});
+}
+} // namespace
+
+std::unique_ptr<champsim::trace_source> champsim::open_trace_source(const std::string& fname)
+{
+  // Uncompressed files are shared through the page cache already
+  if (!std::empty(trace_server_socket) && (fname.substr(0, 4) == "http" || fname.back() == 'z')) {
+    if (auto shared = attach_server(trace_server_socket, fname); shared != nullptr)
+      return shared;
+  }
+  return open_local(fname);
+}
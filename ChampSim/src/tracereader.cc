@@ -17,135 +17,258 @@
 #include "tracereader.h"
 
 #include <algorithm>
-#include <cstring>
+#include <optional>
+#include <stdexcept>
 #include <string>
 
-#if defined(__GNUG__) && !defined(__APPLE__)
-#include <iostream>
-#endif
 #include "champsim.h"
+#include "trace_format.h"
+#include "trace_source.h"
 
-uint64_t tracereader::instr_unique_id = 0;
-void detail::pclose_file(FILE* f) { pclose(f); }
+std::atomic<uint64_t> tracereader::instr_unique_id = 0;
 
-FILE* tracereader::get_fptr(std::string fname)
+namespace
 {
-  std::string cmd_fmtstr = "%1$s %2$s";
-  if (fname.substr(0, 4) == "http")
-    cmd_fmtstr = "wget -qO- -o /dev/null %2$s | %1$s";
-
-  std::string decomp_program = "cat";
-  if (fname.back() == 'z') {
-    std::string last_dot = fname.substr(fname.find_last_of("."));
-    if (last_dot[1] == 'g') // gzip format
-      decomp_program = "gzip -dc";
-    else if (last_dot[1] == 'x') // xz
-      decomp_program = "xz -dc";
+// Decodes the records of one trace file into instructions
+class record_reader
+{
+public:
+  virtual ~record_reader() = default;
+
+  // Passes over up to `count` records and returns how many, which is fewer only at the end of the trace
+  virtual uint64_t skip(uint64_t count) = 0;
+
+  // Appends up to `count` instructions, and returns false at the end of the trace
+  virtual bool read(std::vector<ooo_model_instr>& out, std::size_t count) = 0;
+};
+
+// Traces of fixed-length records, as written by the tracers
+template <typename T>
+class fixed_record_reader : public record_reader
+{
+  std::unique_ptr<champsim::trace_source> source;
+  std::string prefix; // read while checking for the header of a packed trace
+  std::vector<T> records;
+  uint8_t cpu;
+
+  std::size_t read_bytes(char* buf, std::size_t size)
+  {
+    auto from_prefix = std::min(size, std::size(prefix));
+    std::copy_n(std::begin(prefix), from_prefix, buf);
+    prefix.erase(0, from_prefix);
+    return from_prefix + source->read(buf + from_prefix, size - from_prefix);
+  }
+
+public:
+  fixed_record_reader(std::unique_ptr<champsim::trace_source> src, std::string pre, uint8_t cpu_idx)
+      : source(std::move(src)), prefix(std::move(pre)), cpu(cpu_idx)
+  {
+  }
+
+  uint64_t skip(uint64_t count) override
+  {
+    auto from_prefix = std::min<uint64_t>(count * sizeof(T), std::size(prefix));
+    prefix.erase(0, from_prefix);
+    return (from_prefix + source->skip(count * sizeof(T) - from_prefix)) / sizeof(T);
+  }
+
+  bool read(std::vector<ooo_model_instr>& out, std::size_t count) override
+  {
+    records.resize(count);
+    auto bytes_read = read_bytes(reinterpret_cast<char*>(std::data(records)), count * sizeof(T));
+    auto end = std::next(std::begin(records), static_cast<long>(bytes_read / sizeof(T)));
+    for (auto it = std::begin(records); it != end; ++it)
+      out.emplace_back(cpu, *it);
+    return bytes_read == count * sizeof(T);
   }
+};
+
+class packed_record_reader : public record_reader
+{
+  champsim::packed_trace_reader reader;
+  uint8_t cpu;
+
+public:
+  packed_record_reader(std::unique_ptr<champsim::trace_source> src, uint8_t version, uint8_t cpu_idx) : reader(std::move(src), version), cpu(cpu_idx) {}
+
+  // Records are of variable length, so they are decoded and discarded
+  uint64_t skip(uint64_t count) override
+  {
+    champsim::packed_instr instr;
+    uint64_t retval = 0;
+    while (retval < count && reader.read(instr))
+      ++retval;
+    return retval;
+  }
+
+  bool read(std::vector<ooo_model_instr>& out, std::size_t count) override
+  {
+    champsim::packed_instr instr;
+    for (std::size_t i = 0; i < count; ++i) {
+      if (!reader.read(instr))
+        return false;
+      out.emplace_back(cpu, instr);
+    }
+    return true;
+  }
+};
+
+// A packed trace is told apart from one of fixed-length records by its header
+std::unique_ptr<record_reader> open_reader(const std::string& fname, uint8_t cpu, bool is_cloudsuite)
+{
+  auto source = champsim::open_trace_source(fname);
+  std::string header(std::size(champsim::PACKED_TRACE_MAGIC) + 1, '\0');
+  header.resize(source->read(std::data(header), std::size(header)));
 
-  char gunzip_command[4096];
-  snprintf(gunzip_command, std::size(gunzip_command), cmd_fmtstr.c_str(), decomp_program.c_str(), fname.c_str());
-  return popen(gunzip_command, "r");
+  if (std::size(header) > std::size(champsim::PACKED_TRACE_MAGIC)
+      && std::equal(std::begin(champsim::PACKED_TRACE_MAGIC), std::end(champsim::PACKED_TRACE_MAGIC), std::begin(header))) {
+    if (is_cloudsuite)
+      throw std::runtime_error("Packed trace " + fname + " cannot hold cloudsuite instructions");
+    return std::make_unique<packed_record_reader>(std::move(source), static_cast<uint8_t>(header.back()), cpu);
+  }
+
+  if (is_cloudsuite)
+    return std::make_unique<fixed_record_reader<cloudsuite_instr>>(std::move(source), header, cpu);
+  return std::make_unique<fixed_record_reader<input_instr>>(std::move(source), header, cpu);
 }
+} // namespace
 
-template <typename T>
-void tracereader::refresh_buffer()
+tracereader::tracereader(uint8_t cpu_idx, std::string _ts, bool cloudsuite, uint64_t _skip)
+    : trace_string(_ts), cpu(cpu_idx), is_cloudsuite(cloudsuite), skip(_skip)
 {
-  std::array<T, buffer_size - refresh_thresh> trace_read_buf;
-  std::array<char, std::size(trace_read_buf) * sizeof(T)> raw_buf;
-  std::size_t bytes_read;
-
-  // Read from trace file
-#if defined(__GNUG__) && !defined(__APPLE__)
-  std::istream trace_file{&filebuf};
-  trace_file.read(std::data(raw_buf), std::size(raw_buf));
-  bytes_read = static_cast<std::size_t>(trace_file.gcount());
-  eof_ = trace_file.eof();
-#else
-  bytes_read = fread(std::data(raw_buf), sizeof(char), std::size(raw_buf), fp);
-  eof_ = !(bytes_read > 0);
-#endif
-
-  // Transform bytes into trace format instructions
-  std::memcpy(std::data(trace_read_buf), std::data(raw_buf), bytes_read);
-#if defined(_MULTIPLE_PAGE_SIZE)
-	// We also need to get page size information
-  std::array<page_size_info, buffer_size - refresh_thresh> trace_ext_read_buf;
-  std::array<char, std::size(trace_ext_read_buf) * sizeof(page_size_info)> ext_raw_buf;
-  std::size_t ext_bytes_read;
-
-  // Read from trace file
-#if defined(__GNUG__) && !defined(__APPLE__)
-  std::istream trace_ext_file{&ext_filebuf};
-  trace_ext_file.read(std::data(ext_raw_buf), std::size(ext_raw_buf));
-  ext_bytes_read = static_cast<std::size_t>(trace_ext_file.gcount());
-  //eof_ = trace_ext_file.eof(); getting this for normal trace file should be enough
-#else
-	std::cout << "No support of multiple page sizes on apple machines." << std::endl;
-	assert(0);
-#endif
-  // Transform bytes into trace format instructions
-  std::memcpy(std::data(trace_ext_read_buf), std::data(ext_raw_buf), ext_bytes_read);
-	auto pgsz_info_it = std::begin(trace_ext_read_buf);
-#endif
-
-  // Inflate trace format into core model instructions
-  auto begin = std::begin(trace_read_buf);
-  auto end = std::next(begin, bytes_read / sizeof(T));
-//  std::transform(begin, end, std::back_inserter(instr_buffer), [cpu = this->cpu](T t) { return ooo_model_instr{cpu, t}; });
-	auto new_instr = std::back_inserter(instr_buffer);
-	while(begin != end) {
-#if defined(_MULTIPLE_PAGE_SIZE)
-		*new_instr++ = ooo_model_instr(this->cpu, *begin++, *pgsz_info_it++);
-#else
-		*new_instr++ = ooo_model_instr(this->cpu, *begin++);
-#endif
-	}
-
-  for (auto it = std::next(std::begin(instr_buffer)); it != std::end(instr_buffer); ++it)
-    std::prev(it)->branch_target = (std::prev(it)->is_branch && std::prev(it)->branch_taken) ? it->ip : 0;
+  instr_unique_id += skip;
+  decoder = std::thread{[this] { decode(); }};
 }
 
-template <typename T>
-ooo_model_instr tracereader::impl_get()
+void tracereader::decode()
+{
+  try {
+    auto reader = open_reader(trace_string, cpu, is_cloudsuite);
+    if (skip > 0) {
+      // Wrap around the end of the trace as the simulation does
+      auto skipped = reader->skip(skip);
+      if (skipped < skip) {
+        if (skipped == 0)
+          throw std::runtime_error("Trace " + trace_string + " is empty");
+        reader = open_reader(trace_string, cpu, is_cloudsuite);
+        reader->skip(skip % skipped);
+      }
+    }
+
+    // Each instruction is held back until the next one gives its branch target.
+    // At the end of the trace, the next pass is opened here, so that the core does not wait for it.
+    std::optional<ooo_model_instr> pending;
+    std::vector<ooo_model_instr> decoded;
+    batch next;
+    bool pass_empty = true;
+    while (true) {
+      decoded.clear();
+      auto more = reader->read(decoded, batch_size);
+      pass_empty = pass_empty && std::empty(decoded);
+
+      next.instrs.clear();
+      next.ends_pass = false;
+      for (auto& instr : decoded) {
+        if (pending.has_value()) {
+          pending->branch_target = (pending->is_branch && pending->branch_taken) ? instr.ip : 0;
+          next.instrs.push_back(std::move(*pending));
+        }
+        pending = std::move(instr);
+      }
+
+      if (!more) {
+        // A skip that ends exactly at the end of the trace leaves nothing of the first pass
+        if (pass_empty && skip == 0)
+          throw std::runtime_error("Trace " + trace_string + " is empty");
+        if (pending.has_value()) {
+          next.instrs.push_back(std::move(*pending));
+          pending.reset();
+          next.ends_pass = true;
+        }
+        reader = open_reader(trace_string, cpu, is_cloudsuite);
+        pass_empty = true;
+        skip = 0;
+      }
+
+      if (!std::empty(next.instrs) && !push(next))
+        return;
+    }
+  } catch (...) {
+    decode_error = std::current_exception();
+    batch failed;
+    failed.last = true;
+    push(failed);
+  }
+}
+
+bool tracereader::push(batch& b)
 {
-  if (std::size(instr_buffer) <= refresh_thresh)
-    refresh_buffer<T>();
+  auto t = tail.load(std::memory_order_relaxed);
+  if (t - head.load(std::memory_order_acquire) == ring_size) {
+    std::unique_lock lock{wait_mutex};
+    slot_ready.wait(lock, [&] { return stopping || t - head.load(std::memory_order_acquire) < ring_size; });
+  }
+
+  if (stopping)
+    return false;
+
+  // The vector left behind in the slot is reused for the next batch
+  std::swap(ring[t % ring_size], b);
+  tail.store(t + 1, std::memory_order_release);
 
-  auto retval = instr_buffer.front();
-  instr_buffer.pop_front();
+  { std::lock_guard lock{wait_mutex}; }
+  batch_ready.notify_one();
+  return true;
+}
+
+void tracereader::pop()
+{
+  auto h = head.load(std::memory_order_relaxed);
+  if (tail.load(std::memory_order_acquire) == h) {
+    std::unique_lock lock{wait_mutex};
+    batch_ready.wait(lock, [&] { return tail.load(std::memory_order_acquire) != h; });
+  }
 
+  std::swap(current, ring[h % ring_size]);
+  current_pos = 0;
+  head.store(h + 1, std::memory_order_release);
+
+  { std::lock_guard lock{wait_mutex}; }
+  slot_ready.notify_one();
+
+  if (current.last && decode_error)
+    std::rethrow_exception(decode_error);
+}
+
+ooo_model_instr tracereader::operator()()
+{
+  while (current_pos == std::size(current.instrs)) {
+    if (current.last)
+      throw std::runtime_error("Trace " + trace_string + " is empty");
+    pop();
+  }
+
+  auto retval = std::move(current.instrs[current_pos++]);
   retval.instr_id = instr_unique_id++;
+  pass_ended = current.ends_pass && current_pos == std::size(current.instrs);
   return retval;
 }
 
-template <typename T>
-class bulk_tracereader : public tracereader
+tracereader::~tracereader()
 {
-public:
-  using tracereader::tracereader;
-  ooo_model_instr operator()() override final { 
-		return impl_get<T>(); 
-	}
-};
+  {
+    std::lock_guard lock{wait_mutex};
+    stopping = true;
+  }
+  slot_ready.notify_one();
 
-#if defined(_MULTIPLE_PAGE_SIZE)
-std::unique_ptr<tracereader> get_tracereader(	std::string fname, std::string ext_fname, 
-																							uint8_t cpu, bool is_cloudsuite)
-{
-  if (is_cloudsuite)
-    return std::make_unique<bulk_tracereader<cloudsuite_instr>>(cpu, fname, ext_fname);
-  else
-    return std::make_unique<bulk_tracereader<input_instr>>(cpu, fname, ext_fname);
+  if (decoder.joinable())
+    decoder.join();
 }
-#else
-std::unique_ptr<tracereader> get_tracereader(std::string fname, uint8_t cpu, bool is_cloudsuite)
+
+std::unique_ptr<tracereader> get_tracereader(std::string fname, uint8_t cpu, bool is_cloudsuite, uint64_t skip)
 {
-  if (is_cloudsuite)
-    return std::make_unique<bulk_tracereader<cloudsuite_instr>>(cpu, fname);
-  else
-    return std::make_unique<bulk_tracereader<input_instr>>(cpu, fname);
+  return std::make_unique<tracereader>(cpu, fname, is_cloudsuite, skip);
 }
-#endif
 
-bool tracereader::eof() const { return eof_ && std::size(instr_buffer) <= refresh_thresh; }
+bool tracereader::eof() const { return pass_ended; }
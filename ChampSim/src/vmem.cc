@@ -59,43 +59,77 @@ uint64_t VirtualMemory::get_offset(uint64_t vaddr, std::size_t level) const
   return (vaddr >> shamt(level)) & champsim::bitmask(champsim::lg2(pte_page_size / PTE_BYTES));
 }
 
-uint64_t VirtualMemory::ppage_front() const
+uint64_t VirtualMemory::ppage_front(uint32_t cpu_num) const
 {
   assert(available_ppages() > 0);
-  return next_ppage;
+  return std::empty(cpu_next_ppage) ? next_ppage : cpu_next_ppage.at(cpu_num);
 }
 
-void VirtualMemory::ppage_pop() { next_ppage += PAGE_SIZE; }
+void VirtualMemory::ppage_pop(uint32_t cpu_num)
+{
+  if (std::empty(cpu_next_ppage))
+    next_ppage += PAGE_SIZE;
+  else {
+    auto& next = cpu_next_ppage.at(cpu_num);
+    next += PAGE_SIZE;
+    if ((next - cpu_stream_base) % (PAGE_SIZE * CPU_STREAM_PAGES) == 0)
+      next += PAGE_SIZE * CPU_STREAM_PAGES * (std::size(cpu_next_ppage) - 1);
+  }
+}
+
+std::size_t VirtualMemory::available_ppages() const
+{
+  if (std::empty(cpu_next_ppage))
+    return (last_ppage - next_ppage) / PAGE_SIZE;
+
+  auto front = *std::max_element(std::begin(cpu_next_ppage), std::end(cpu_next_ppage));
+  return front < last_ppage ? (last_ppage - front) / PAGE_SIZE : 0;
+}
 
-std::size_t VirtualMemory::available_ppages() const { return (last_ppage - next_ppage) / PAGE_SIZE; }
+void VirtualMemory::split_by_cpu(std::size_t num_cpus)
+{
+  // Deal out the remaining physical pages in fixed-size runs, so that each CPU's mappings depend only on its own order of requests
+  std::lock_guard lock{mutex};
+  if (std::size(cpu_next_ppage) == num_cpus)
+    return; // already dealt out, as restored from a checkpoint
+
+  cpu_stream_base = next_ppage;
+  cpu_next_ppage.clear();
+  for (std::size_t i = 0; i < num_cpus; ++i)
+    cpu_next_ppage.push_back(cpu_stream_base + i * PAGE_SIZE * CPU_STREAM_PAGES);
+  cpu_next_pte_page.assign(num_cpus, 0);
+}
 
 std::pair<uint64_t, uint64_t> VirtualMemory::va_to_pa(uint32_t cpu_num, uint64_t vaddr)
 {
-  auto [ppage, fault] = vpage_to_ppage_map.insert({{cpu_num, vaddr >> LOG2_PAGE_SIZE}, ppage_front()});
+  std::lock_guard lock{mutex};
+  auto [ppage, fault] = vpage_to_ppage_map.insert({{cpu_num, vaddr >> LOG2_PAGE_SIZE}, ppage_front(cpu_num)});
 
   // this vpage doesn't yet have a ppage mapping
   if (fault)
-    ppage_pop();
+    ppage_pop(cpu_num);
 
   return {champsim::splice_bits(ppage->second, vaddr, LOG2_PAGE_SIZE), fault ? minor_fault_penalty : 0};
 }
 
 std::pair<uint64_t, uint64_t> VirtualMemory::get_pte_pa(uint32_t cpu_num, uint64_t vaddr, std::size_t level)
 {
-  if (next_pte_page == 0) {
-    next_pte_page = ppage_front();
-    ppage_pop();
+  std::lock_guard lock{mutex};
+  auto& next_pte = std::empty(cpu_next_pte_page) ? next_pte_page : cpu_next_pte_page.at(cpu_num);
+  if (next_pte == 0) {
+    next_pte = ppage_front(cpu_num);
+    ppage_pop(cpu_num);
   }
 
   std::tuple key{cpu_num, vaddr >> shamt(level), level};
-  auto [ppage, fault] = page_table.insert({key, next_pte_page});
+  auto [ppage, fault] = page_table.insert({key, next_pte});
 
   // this PTE doesn't yet have a mapping
   if (fault) {
-    next_pte_page += pte_page_size;
-    if (!(next_pte_page % PAGE_SIZE)) {
-      next_pte_page = ppage_front();
-      ppage_pop();
+    next_pte += pte_page_size;
+    if (!(next_pte % PAGE_SIZE)) {
+      next_pte = ppage_front(cpu_num);
+      ppage_pop(cpu_num);
     }
   }
 
@@ -111,3 +145,18 @@ std::pair<uint64_t, uint64_t> VirtualMemory::get_pte_pa(uint32_t cpu_num, uint64
 
   return {paddr, fault ? minor_fault_penalty : 0};
 }
+
+void VirtualMemory::serialize(champsim::checkpoint_archive& ar)
+{
+  std::lock_guard lock{mutex};
+  ar.expect(pt_levels);
+  ar.expect(pte_page_size);
+  ar.io(vpage_to_ppage_map);
+  ar.io(page_table);
+  ar.io(next_pte_page);
+  ar.io(next_ppage);
+  ar.io(last_ppage);
+  ar.io(cpu_stream_base);
+  ar.io(cpu_next_ppage);
+  ar.io(cpu_next_pte_page);
+}
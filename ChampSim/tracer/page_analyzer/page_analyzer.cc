@@ -0,0 +1,404 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+// Reads a trace once and reports the footprint and reuse of its code and data pages. It then chooses which 2 MB regions are mapped by
+// large pages and writes them as a page size map (see inc/page_map.h), which the simulator loads in place of choosing page sizes at
+// random as it goes.
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "page_map.h"
+#include "trace_format.h"
+#include "trace_source.h"
+
+namespace
+{
+constexpr std::size_t CHUNK_INSTRS = 1 << 20; // instructions read while the workers go over the previous ones
+constexpr std::size_t REUSE_BUCKETS = 64;
+constexpr unsigned REGION_SHIFT = champsim::LARGE_PAGE_BITS - champsim::SMALL_PAGE_BITS;
+
+// A run of instructions that touch the same 4 KB page. Each data access is a run of one.
+struct access {
+  uint64_t vpn;
+  uint64_t first_instr;
+  uint64_t count;
+};
+
+struct chunk {
+  std::vector<access> code, data;
+};
+
+struct page_stats {
+  uint64_t accesses = 0;
+  uint64_t last_instr = 0;
+};
+
+uint64_t mix(uint64_t x)
+{
+  // splitmix64
+  x += 0x9e3779b97f4a7c15ull;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+// Each worker follows the pages that hash to it, so it sees every access to them in order and can measure their reuse
+struct shard {
+  std::unordered_map<uint64_t, page_stats> pages;
+  std::array<uint64_t, REUSE_BUCKETS> reuse = {}; // by the log2 of the instructions since the last access to the page
+
+  void add(const std::vector<access>& accesses, unsigned id, unsigned num_shards)
+  {
+    for (const auto& a : accesses) {
+      if (mix(a.vpn) % num_shards != id)
+        continue;
+      auto [it, inserted] = pages.try_emplace(a.vpn);
+      if (!inserted) {
+        auto distance = a.first_instr - it->second.last_instr;
+        auto bucket = 0u;
+        while (bucket + 1 < REUSE_BUCKETS && (distance >> (bucket + 1)) != 0)
+          ++bucket;
+        ++reuse[bucket];
+      }
+      it->second.accesses += a.count;
+      it->second.last_instr = a.first_instr + a.count - 1;
+    }
+  }
+};
+
+struct region_stats {
+  uint64_t region = 0;
+  uint64_t accesses = 0;
+  uint64_t pages = 0;
+};
+
+// Reads the ip and memory addresses of each instruction, from a trace of fixed-length records or a packed trace
+class instr_reader
+{
+  std::unique_ptr<champsim::trace_source> source;
+  std::optional<champsim::packed_trace_reader> packed;
+  std::string prefix; // read while checking for the header of a packed trace
+  bool is_cloudsuite;
+
+  template <typename T>
+  bool read_fixed(uint64_t& ip, std::vector<uint64_t>& addrs)
+  {
+    T record;
+    auto bytes = reinterpret_cast<char*>(&record);
+    auto from_prefix = std::min(sizeof(T), std::size(prefix));
+    std::copy_n(std::begin(prefix), from_prefix, bytes);
+    prefix.erase(0, from_prefix);
+    auto bytes_read = from_prefix + source->read(bytes + from_prefix, sizeof(T) - from_prefix);
+    if (bytes_read != 0 && bytes_read != sizeof(T))
+      throw std::runtime_error("Trace ends within a record");
+    if (bytes_read == 0)
+      return false;
+
+    ip = record.ip;
+    addrs.assign(std::begin(record.destination_memory), std::end(record.destination_memory));
+    addrs.insert(std::end(addrs), std::begin(record.source_memory), std::end(record.source_memory));
+    return true;
+  }
+
+public:
+  instr_reader(const std::string& fname, bool cloudsuite) : source(champsim::open_trace_source(fname)), is_cloudsuite(cloudsuite)
+  {
+    prefix.resize(std::size(champsim::PACKED_TRACE_MAGIC) + 1);
+    prefix.resize(source->read(std::data(prefix), std::size(prefix)));
+    if (std::size(prefix) > std::size(champsim::PACKED_TRACE_MAGIC)
+        && std::equal(std::begin(champsim::PACKED_TRACE_MAGIC), std::end(champsim::PACKED_TRACE_MAGIC), std::begin(prefix)))
+      packed.emplace(std::move(source), static_cast<uint8_t>(prefix.back()));
+  }
+
+  // Returns false at the end of the trace. Absent addresses are zero.
+  bool read(uint64_t& ip, std::vector<uint64_t>& addrs)
+  {
+    if (packed.has_value()) {
+      champsim::packed_instr instr;
+      if (!packed->read(instr))
+        return false;
+      ip = instr.instr.ip;
+      addrs.assign(std::begin(instr.instr.destination_memory), std::end(instr.instr.destination_memory));
+      addrs.insert(std::end(addrs), std::begin(instr.instr.source_memory), std::end(instr.instr.source_memory));
+      return true;
+    }
+    if (is_cloudsuite)
+      return read_fixed<cloudsuite_instr>(ip, addrs);
+    return read_fixed<input_instr>(ip, addrs);
+  }
+};
+
+class analyzer
+{
+  instr_reader reader;
+  unsigned num_workers;
+  std::vector<shard> code_shards, data_shards;
+  uint64_t num_instrs = 0;
+  std::optional<access> code_run; // the run of the last instructions, which the next one may extend
+  std::vector<uint64_t> addrs;
+
+  // Returns false at the end of the trace
+  bool read_chunk(chunk& out)
+  {
+    out.code.clear();
+    out.data.clear();
+    uint64_t ip = 0;
+    for (std::size_t i = 0; i < CHUNK_INSTRS; ++i, ++num_instrs) {
+      if (!reader.read(ip, addrs)) {
+        if (code_run.has_value())
+          out.code.push_back(*code_run);
+        code_run.reset();
+        return false;
+      }
+
+      auto vpn = ip >> champsim::SMALL_PAGE_BITS;
+      if (code_run.has_value() && code_run->vpn == vpn) {
+        ++code_run->count;
+      } else {
+        if (code_run.has_value())
+          out.code.push_back(*code_run);
+        code_run = access{vpn, num_instrs, 1};
+      }
+
+      // An instruction that touches a page twice accesses it once
+      std::sort(std::begin(addrs), std::end(addrs));
+      uint64_t last_vpn = 0;
+      for (auto addr : addrs) {
+        if (addr != 0 && (addr >> champsim::SMALL_PAGE_BITS) != last_vpn) {
+          last_vpn = addr >> champsim::SMALL_PAGE_BITS;
+          out.data.push_back(access{last_vpn, num_instrs, 1});
+        }
+      }
+    }
+    return true;
+  }
+
+  void process(const chunk& work, std::vector<std::thread>& workers)
+  {
+    for (unsigned id = 0; id < num_workers; ++id) {
+      workers.emplace_back([this, &work, id] {
+        code_shards[id].add(work.code, id, num_workers);
+        data_shards[id].add(work.data, id, num_workers);
+      });
+    }
+  }
+
+public:
+  analyzer(const std::string& fname, bool cloudsuite, unsigned workers)
+      : reader(fname, cloudsuite), num_workers(workers), code_shards(workers), data_shards(workers)
+  {
+  }
+
+  void run()
+  {
+    chunk current, next;
+    auto more = read_chunk(current);
+    while (true) {
+      std::vector<std::thread> workers;
+      process(current, workers);
+      auto next_more = more && read_chunk(next);
+      for (auto& worker : workers)
+        worker.join();
+
+      if (!more)
+        break;
+      std::swap(current, next);
+      more = next_more;
+    }
+  }
+
+  uint64_t instructions() const { return num_instrs; }
+  const std::vector<shard>& code() const { return code_shards; }
+  const std::vector<shard>& data() const { return data_shards; }
+};
+
+std::vector<region_stats> regions_of(const std::vector<shard>& shards)
+{
+  std::unordered_map<uint64_t, region_stats> regions;
+  for (const auto& s : shards) {
+    for (const auto& [vpn, page] : s.pages) {
+      auto& region = regions[vpn >> REGION_SHIFT];
+      region.region = vpn >> REGION_SHIFT;
+      region.accesses += page.accesses;
+      ++region.pages;
+    }
+  }
+
+  std::vector<region_stats> retval;
+  for (const auto& entry : regions)
+    retval.push_back(entry.second);
+  std::sort(std::begin(retval), std::end(retval), [](const auto& x, const auto& y) { return x.region < y.region; });
+  return retval;
+}
+
+enum class policy { random, hot, dense };
+
+// Returns the sorted numbers of the regions to be mapped by large pages
+std::vector<uint64_t> choose_large(std::vector<region_stats> regions, policy how, unsigned percent, uint64_t seed)
+{
+  std::vector<uint64_t> retval;
+  if (how == policy::random) {
+    // Each region independently, as the simulator chooses each page at random
+    for (const auto& r : regions)
+      if (mix(r.region ^ seed) % 100 < percent)
+        retval.push_back(r.region);
+    return retval;
+  }
+
+  // The given share of the regions, taking first the most accessed or those with the most 4 KB pages touched
+  auto rank = [how](const region_stats& x, const region_stats& y) {
+    if (how == policy::dense && x.pages != y.pages)
+      return x.pages > y.pages;
+    if (x.accesses != y.accesses)
+      return x.accesses > y.accesses;
+    return x.region < y.region;
+  };
+  std::sort(std::begin(regions), std::end(regions), rank);
+  auto count = (std::size(regions) * percent + 50) / 100;
+  for (std::size_t i = 0; i < count && i < std::size(regions); ++i)
+    retval.push_back(regions[i].region);
+  std::sort(std::begin(retval), std::end(retval));
+  return retval;
+}
+
+void print_footprint(const std::string& name, const std::vector<shard>& shards, const std::vector<region_stats>& regions)
+{
+  uint64_t pages = 0;
+  std::array<uint64_t, REUSE_BUCKETS> reuse = {};
+  for (const auto& s : shards) {
+    pages += std::size(s.pages);
+    for (std::size_t i = 0; i < REUSE_BUCKETS; ++i)
+      reuse[i] += s.reuse[i];
+  }
+
+  std::cout << name << " footprint: " << pages << " pages of 4 KB (" << (pages << champsim::SMALL_PAGE_BITS) / 1024 << " KB) in " << std::size(regions)
+            << " regions of 2 MB" << std::endl;
+
+  auto total = std::accumulate(std::begin(reuse), std::end(reuse), uint64_t{0});
+  if (total == 0)
+    return;
+  std::cout << name << " reuse, in instructions since the last access to the same 4 KB page:" << std::endl;
+  for (std::size_t i = 0; i < REUSE_BUCKETS; ++i) {
+    if (reuse[i] != 0) {
+      std::cout << "  " << std::setw(12) << (uint64_t{1} << i) << "+ " << std::setw(12) << reuse[i] << " " << std::fixed << std::setprecision(2)
+                << std::setw(6) << 100.0 * static_cast<double>(reuse[i]) / static_cast<double>(total) << "%" << std::endl;
+    }
+  }
+}
+
+void print_choice(const std::string& name, const std::vector<region_stats>& regions, const std::vector<uint64_t>& large)
+{
+  uint64_t accesses = 0, covered = 0;
+  for (const auto& r : regions) {
+    accesses += r.accesses;
+    if (std::binary_search(std::begin(large), std::end(large), r.region))
+      covered += r.accesses;
+  }
+  std::cout << name << " large pages: " << std::size(large) << " of " << std::size(regions) << " regions, holding " << std::fixed << std::setprecision(2)
+            << (accesses == 0 ? 0.0 : 100.0 * static_cast<double>(covered) / static_cast<double>(accesses)) << "% of accesses" << std::endl;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+  std::string trace_name, map_name;
+  auto threads = std::max(1u, std::thread::hardware_concurrency());
+  auto how = policy::random;
+  unsigned long code_percent = 0, data_percent = 0;
+  uint64_t seed = 0;
+  bool cloudsuite = false;
+  bool usage_error = false;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg{argv[i]};
+    if (arg == "--map" && i + 1 < argc) {
+      map_name = argv[++i];
+    } else if (arg == "--threads" && i + 1 < argc) {
+      threads = std::max(1u, static_cast<unsigned>(std::stoul(argv[++i])));
+    } else if (arg == "--code-large" && i + 1 < argc) {
+      code_percent = std::stoul(argv[++i]);
+    } else if (arg == "--data-large" && i + 1 < argc) {
+      data_percent = std::stoul(argv[++i]);
+    } else if (arg == "--seed" && i + 1 < argc) {
+      seed = std::stoull(argv[++i]);
+    } else if (arg == "--cloudsuite") {
+      cloudsuite = true;
+    } else if (arg == "--policy" && i + 1 < argc) {
+      std::string name{argv[++i]};
+      if (name == "random")
+        how = policy::random;
+      else if (name == "hot")
+        how = policy::hot;
+      else if (name == "dense")
+        how = policy::dense;
+      else
+        usage_error = true;
+    } else if (std::empty(trace_name)) {
+      trace_name = arg;
+    } else {
+      usage_error = true;
+    }
+  }
+
+  if (usage_error || std::empty(trace_name) || code_percent > 100 || data_percent > 100) {
+    std::cerr << "Usage: " << argv[0]
+              << " TRACE [--map FILE] [--policy random|hot|dense] [--code-large PERCENT] [--data-large PERCENT] [--seed N] [--threads N] [--cloudsuite]"
+              << std::endl;
+    return 1;
+  }
+
+  try {
+    analyzer scan{trace_name, cloudsuite, threads};
+    scan.run();
+
+    auto code_regions = regions_of(scan.code());
+    auto data_regions = regions_of(scan.data());
+    std::cout << "Instructions: " << scan.instructions() << std::endl;
+    print_footprint("Code", scan.code(), code_regions);
+    print_footprint("Data", scan.data(), data_regions);
+
+    auto code_large = choose_large(code_regions, how, static_cast<unsigned>(code_percent), seed);
+    auto data_large = choose_large(data_regions, how, static_cast<unsigned>(data_percent), mix(seed));
+    print_choice("Code", code_regions, code_large);
+    print_choice("Data", data_regions, data_large);
+
+    if (!std::empty(map_name)) {
+      std::ofstream out{map_name, std::ios::binary};
+      champsim::write_page_size_map(out, code_large, data_large);
+      if (!out.flush())
+        throw std::runtime_error("Could not write " + map_name);
+    }
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
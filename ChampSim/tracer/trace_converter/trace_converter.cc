@@ -0,0 +1,111 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// Converts a trace of fixed-length records into a packed trace, as described in inc/trace_format.h. The page of each address may be
+// taken from a side file of the records that older versions of this simulator read alongside the trace.
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "trace_format.h"
+#include "trace_source.h"
+
+namespace
+{
+// A record of the side file, one for each instruction of the trace
+struct legacy_page_info {
+  uint64_t base_vpn_destination[NUM_INSTR_DESTINATIONS] = {};
+  uint64_t base_vpn_source[NUM_INSTR_SOURCES] = {};
+  uint8_t page_size_destination[NUM_INSTR_DESTINATIONS] = {};
+  uint8_t page_size_source[NUM_INSTR_SOURCES] = {};
+};
+
+template <typename T>
+bool read_record(champsim::trace_source& source, T& record)
+{
+  auto bytes_read = source.read(reinterpret_cast<char*>(&record), sizeof(T));
+  if (bytes_read != 0 && bytes_read != sizeof(T))
+    throw std::runtime_error("Trace ends within a record");
+  return bytes_read == sizeof(T);
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+  std::vector<std::string> files;
+  std::string page_file;
+  unsigned long version = champsim::PACKED_TRACE_VERSION;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg{argv[i]};
+    if (arg == "--page-info" && i + 1 < argc)
+      page_file = argv[++i];
+    else if (arg == "--format-version" && i + 1 < argc)
+      version = std::stoul(argv[++i]);
+    else
+      files.push_back(arg);
+  }
+
+  if (std::size(files) != 2) {
+    std::cerr << "Usage: " << argv[0] << " INPUT OUTPUT [--page-info PAGE_FILE] [--format-version N]" << std::endl;
+    return 1;
+  }
+
+  try {
+    auto trace = champsim::open_trace_source(files[0]);
+    std::unique_ptr<champsim::trace_source> pages;
+    if (!std::empty(page_file))
+      pages = champsim::open_trace_source(page_file);
+
+    std::ofstream out{files[1], std::ios::binary};
+    if (!out)
+      throw std::runtime_error("Could not open " + files[1]);
+
+    uint64_t count = 0;
+    {
+      champsim::packed_trace_writer writer{out, static_cast<uint8_t>(version)};
+      champsim::packed_instr packed;
+      while (read_record(*trace, packed.instr)) {
+        legacy_page_info page;
+        if (pages != nullptr && !read_record(*pages, page))
+          throw std::runtime_error("Page file is shorter than the trace");
+
+        for (std::size_t i = 0; i < NUM_INSTR_DESTINATIONS; ++i)
+          packed.destination_pages[i] = {page.page_size_destination[i], page.base_vpn_destination[i]};
+        for (std::size_t i = 0; i < NUM_INSTR_SOURCES; ++i)
+          packed.source_pages[i] = {page.page_size_source[i], page.base_vpn_source[i]};
+
+        writer.write(packed);
+        ++count;
+      }
+    }
+
+    if (!out.flush())
+      throw std::runtime_error("Could not write " + files[1]);
+    std::cerr << "Converted " << count << " instructions" << std::endl;
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
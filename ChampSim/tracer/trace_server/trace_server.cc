@@ -0,0 +1,304 @@
+/*
+ *    Copyright 2023 The ChampSim Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// Decompresses traces once into shared memory for all of the simulators on a host that read them, as described in inc/trace_server.h
+
+#include <atomic>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <poll.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#include "trace_server.h"
+#include "trace_source.h"
+
+namespace
+{
+using champsim::trace_server::shared_header;
+
+std::atomic<bool> stopping = false;
+
+struct cached_trace {
+  std::string name;     // of the trace
+  std::string shm_name; // of its shared memory
+  int fd = -1;
+  shared_header* header = nullptr;
+  std::thread decoder;
+  uint64_t size = 0; // bytes reserved for it
+  unsigned references = 0;
+  uint64_t last_used = 0;
+};
+
+class server
+{
+  const uint64_t capacity; // bytes of decompressed traces held at once
+  std::mutex mutex;
+  std::map<std::string, std::unique_ptr<cached_trace>> traces; // by name and modification time
+  uint64_t resident = 0;
+  uint64_t clock = 0;
+  unsigned next_id = 0;
+
+  void decode(cached_trace& trace);
+  bool reserve(cached_trace& trace, uint64_t size);
+  void evict(std::map<std::string, std::unique_ptr<cached_trace>>::iterator it);
+
+public:
+  explicit server(uint64_t cap) : capacity(cap) {}
+  ~server();
+
+  // Returns the key of the trace, which the client holds until it disconnects, and the name of its shared memory.
+  // Throws if the trace cannot be served.
+  std::pair<std::string, std::string> acquire(const std::string& name);
+  void release(const std::string& key);
+};
+
+void server::decode(cached_trace& trace)
+{
+  std::vector<char> buffer(1 << 20);
+  uint64_t written = 0;
+  try {
+    auto source = champsim::open_trace_source(trace.name);
+    while (auto bytes_read = source->read(std::data(buffer), std::size(buffer))) {
+      if (stopping)
+        throw std::runtime_error("Server is stopping");
+      if (!reserve(trace, bytes_read))
+        throw std::runtime_error("Out of capacity");
+      if (pwrite(trace.fd, std::data(buffer), bytes_read, static_cast<off_t>(champsim::trace_server::DATA_OFFSET + written))
+          != static_cast<ssize_t>(bytes_read))
+        throw std::runtime_error(std::strerror(errno));
+      written += bytes_read;
+      trace.header->available.store(written, std::memory_order_release);
+    }
+    trace.header->state.store(champsim::trace_server::COMPLETE, std::memory_order_release);
+    std::cout << "Decompressed " << trace.name << " (" << written << " bytes)" << std::endl;
+  } catch (const std::exception& e) {
+    trace.header->state.store(champsim::trace_server::FAILED, std::memory_order_release);
+    std::cout << "Stopped decompressing " << trace.name << " after " << written << " bytes: " << e.what() << std::endl;
+  }
+}
+
+// Makes room for `size` more bytes by evicting the least recently used traces that no client holds
+bool server::reserve(cached_trace& trace, uint64_t size)
+{
+  std::lock_guard lock{mutex};
+  while (resident + size > capacity) {
+    auto victim = std::end(traces);
+    for (auto it = std::begin(traces); it != std::end(traces); ++it) {
+      auto state = it->second->header->state.load();
+      if (it->second->references == 0 && state != champsim::trace_server::DECODING && (victim == std::end(traces) || it->second->last_used < victim->second->last_used))
+        victim = it;
+    }
+    if (victim == std::end(traces))
+      return false;
+    evict(victim);
+  }
+  resident += size;
+  trace.size += size;
+  return true;
+}
+
+// Clients that still map the trace keep their mapping
+void server::evict(std::map<std::string, std::unique_ptr<cached_trace>>::iterator it)
+{
+  auto& trace = *it->second;
+  if (trace.decoder.joinable())
+    trace.decoder.join();
+  resident -= trace.size;
+  std::cout << "Evicted " << trace.name << std::endl;
+  munmap(trace.header, champsim::trace_server::DATA_OFFSET);
+  close(trace.fd);
+  shm_unlink(trace.shm_name.c_str());
+  traces.erase(it);
+}
+
+std::pair<std::string, std::string> server::acquire(const std::string& name)
+{
+  // A trace that has changed since it was decompressed is treated as another
+  std::string key = name;
+  if (struct stat status; name.substr(0, 4) != "http" && stat(name.c_str(), &status) == 0)
+    key += "@" + std::to_string(status.st_mtim.tv_sec) + "." + std::to_string(status.st_mtim.tv_nsec);
+
+  std::lock_guard lock{mutex};
+  auto it = traces.find(key);
+  if (it != std::end(traces) && it->second->header->state.load() == champsim::trace_server::FAILED) {
+    if (it->second->references > 0)
+      throw std::runtime_error("Trace could not be decompressed");
+    evict(it);
+    it = std::end(traces);
+  }
+
+  if (it == std::end(traces)) {
+    auto trace = std::make_unique<cached_trace>();
+    trace->name = name;
+    trace->shm_name = "/champsim_trace_" + std::to_string(getpid()) + "_" + std::to_string(next_id++);
+    trace->fd = shm_open(trace->shm_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (trace->fd < 0)
+      throw std::runtime_error(std::strerror(errno));
+
+    // The shared memory is sparse, so only the part that holds the trace takes up memory
+    void* header = MAP_FAILED;
+    if (ftruncate(trace->fd, static_cast<off_t>(champsim::trace_server::DATA_OFFSET + capacity)) == 0)
+      header = mmap(nullptr, champsim::trace_server::DATA_OFFSET, PROT_READ | PROT_WRITE, MAP_SHARED, trace->fd, 0);
+    if (header == MAP_FAILED) {
+      auto reason = std::strerror(errno);
+      close(trace->fd);
+      shm_unlink(trace->shm_name.c_str());
+      throw std::runtime_error(reason);
+    }
+
+    trace->header = new (header) shared_header{};
+    trace->decoder = std::thread{[this, t = trace.get()] { decode(*t); }};
+    it = traces.emplace(key, std::move(trace)).first;
+  }
+
+  ++it->second->references;
+  it->second->last_used = ++clock;
+  return {key, it->second->shm_name};
+}
+
+void server::release(const std::string& key)
+{
+  std::lock_guard lock{mutex};
+  auto it = traces.find(key);
+  --it->second->references;
+  it->second->last_used = ++clock;
+  if (it->second->references == 0 && it->second->header->state.load() == champsim::trace_server::FAILED)
+    evict(it);
+}
+
+// The decoders stop once `stopping` is set, and may need the lock to do so
+server::~server()
+{
+  for (auto& [key, trace] : traces) {
+    if (trace->decoder.joinable())
+      trace->decoder.join();
+  }
+
+  for (auto& [key, trace] : traces) {
+    munmap(trace->header, champsim::trace_server::DATA_OFFSET);
+    close(trace->fd);
+    shm_unlink(trace->shm_name.c_str());
+  }
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+  std::string socket_path = "/tmp/champsim_trace_server";
+  uint64_t capacity_mb = 16384;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg{argv[i]};
+    if (arg == "--socket" && i + 1 < argc) {
+      socket_path = argv[++i];
+    } else if (arg == "--capacity_mb" && i + 1 < argc) {
+      capacity_mb = std::stoull(argv[++i]);
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--socket PATH] [--capacity_mb N]" << std::endl;
+      return 1;
+    }
+  }
+
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (std::size(socket_path) >= sizeof(address.sun_path)) {
+    std::cerr << "Socket path is too long" << std::endl;
+    return 1;
+  }
+  std::strcpy(address.sun_path, socket_path.c_str());
+
+  int listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  unlink(socket_path.c_str());
+  if (listener < 0 || bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listener, 64) != 0) {
+    std::cerr << "Could not listen on " << socket_path << ": " << std::strerror(errno) << std::endl;
+    return 1;
+  }
+
+  struct sigaction action {};
+  action.sa_handler = [](int) { stopping = true; };
+  sigaction(SIGINT, &action, nullptr);
+  sigaction(SIGTERM, &action, nullptr);
+  signal(SIGPIPE, SIG_IGN);
+
+  std::cout << "Serving traces on " << socket_path << " with a capacity of " << capacity_mb << " MiB" << std::endl;
+  server traces{capacity_mb << 20};
+  std::map<int, std::string> clients; // by connection, the key of the trace each holds
+  std::vector<pollfd> fds;
+  while (!stopping) {
+    fds.assign(1, pollfd{listener, POLLIN, 0});
+    for (const auto& [fd, key] : clients)
+      fds.push_back(pollfd{fd, POLLIN, 0});
+    if (poll(std::data(fds), std::size(fds), -1) < 0)
+      continue;
+
+    // Clients send nothing after their request, so anything more is the end of the connection
+    for (auto it = std::next(std::begin(fds)); it != std::end(fds); ++it) {
+      if (it->revents != 0) {
+        traces.release(clients.at(it->fd));
+        clients.erase(it->fd);
+        close(it->fd);
+      }
+    }
+
+    if (fds.front().revents & POLLIN) {
+      int client = accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+      if (client < 0)
+        continue;
+
+      std::string name;
+      char c;
+      while (read(client, &c, 1) == 1 && c != '\n')
+        name.push_back(c);
+
+      std::string reply;
+      try {
+        auto [key, shm_name] = traces.acquire(name);
+        clients.emplace(client, key);
+        reply = "OK " + shm_name + "\n";
+      } catch (const std::exception& e) {
+        reply = std::string{"ERR "} + e.what() + "\n";
+      }
+      if (write(client, reply.c_str(), std::size(reply)) < 0 || reply.front() != 'O') {
+        if (auto it = clients.find(client); it != std::end(clients)) {
+          traces.release(it->second);
+          clients.erase(it);
+        }
+        close(client);
+      }
+    }
+  }
+
+  std::cout << "Stopping" << std::endl;
+  close(listener);
+  unlink(socket_path.c_str());
+  for (const auto& [fd, key] : clients)
+    close(fd);
+  return 0;
+}
@@ -6,3 +6,5 @@ export DUMP_DIR=${ROOT_DIR}/dump
 export STATS_DIR=${STATS_DIR}/stats
 export FIGURES_DIR=${ROOT_DIR}/figures
 export BATCH_SIZE=10
+# Socket of a running trace server (ChampSim/tracer/trace_server), through which jobs share decompressed traces
+export TRACE_SERVER_SOCKET=${TRACE_SERVER_SOCKET:-}
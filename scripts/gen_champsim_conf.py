@@ -92,6 +92,8 @@ if len(sys.argv) >= 4:
     if (is_smt):
         print("Enabling smt workloads.")
         set_entry(new_config, 'L2C', attr_names['m'], True)  
+        # each smt workload runs its two traces on the hardware threads of one core
+        set_entry(new_config, 'ooo_cpu', 'smt_threads', 2)
 
     print("\nSaved new configuration file sim_conf/champsim_" + conf_tag + '.json.\n')
     save_config(new_config, 'sim_conf/champsim_' + conf_tag + '.json')
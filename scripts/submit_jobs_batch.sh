@@ -45,9 +45,16 @@ for i in {${ti}..$(( ti+BATCH_SIZE ))}; do
 	export DATA_PAGE_DIST_FILENAME=${DUMP_DIR}/\${bench}${DATA_PAGE_DIST_FILENAME_SUFFIX}.pdst
 	export PAGE_ADDRESS_STATS_FILENAME_PREFIX=${DUMP_DIR}/\${bench}${DESCR_TAG}_page_access_stats
 
+	# An smt workload (smt_<bench1>_<bench2>_<block>i) runs the traces of its two benchmarks on the threads of one core
+	trace_files=${TRACE_DIR}/\${trace}
+	if [[ ${BENCHSUITE} == smt_* ]]; then
+		trace_files=\$(echo \${trace} | sed -E \"s#^smt_([^_]+_ap)_([^_]+_ap)_[0-9]+i\\\\.champsimtrace\\\\.xz\\\$#${TRACE_DIR}/\\\\1\${suffix} ${TRACE_DIR}/\\\\2\${suffix}#\")
+	fi
+
 	${CHAMPSIM_DIR}/bin/${BIN} 	--warmup_instructions ${SIM_WARMUP_INSTR} \
 															--simulation_instructions ${SIM_RUN_INSTR} \
-															${TRACE_DIR}/\${trace} > ${DUMP_DIR}/\${bench}${DESCR_TAG}_run.out 
+															${TRACE_SERVER_SOCKET:+--trace_server ${TRACE_SERVER_SOCKET}} \
+															\${trace_files} > ${DUMP_DIR}/\${bench}${DESCR_TAG}_run.out 
 done
 " >	simr_${BENCHSUITE}_${ti}${DESCR_TAG}_job.run
 		sbatch simr_${BENCHSUITE}_${ti}${DESCR_TAG}_job.run